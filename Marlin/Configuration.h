@@ -1483,6 +1483,7 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT    // Init EEPROM automatically on any errors.
+  //#define FLASH_EEPROM_LOG  // With FLASH_EEPROM_LEVELING append only the changed parts of the EEPROM to flash
 #endif
 
 //
@@ -115,6 +115,21 @@
   #define CHAMBER_BETA                 3950    // Beta value
 #endif
 
+/**
+ * Thermistor Direct Lookup
+ *
+ * Find the thermistor table segment for each reading with an index generated
+ * by the compiler, instead of a binary search on every reading. Results are
+ * unchanged. Custom thermistors (1000) get a curve table in RAM, rebuilt when
+ * M305 changes their parameters, instead of evaluating logarithms each time.
+ * The index uses 256 bytes of flash per sensor. A custom thermistor table uses
+ * 514 bytes of RAM and is accurate to about 0.25°C up to 300°C.
+ */
+//#define THERMISTOR_DIRECT_LOOKUP
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  //#define THERMISTOR_COMPACT_LOOKUP // Quarter-size tables. Slower lookups, and custom thermistors only accurate to ~3°C at 300°C.
+#endif
+
 //
 // Hephestos 2 24V heated bed upgrade kit.
 // https://store.bq.com/en/heated-bed-kit-hephestos2
@@ -978,6 +993,73 @@
  */
 #define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Step Event Schedule
+ * Precompute the step events of the current block a short time ahead, as a list
+ * of axis-masks and delays. The Stepper ISR only replays the list, so its pulses
+ * keep a steady timing, and steps that would be bunched up by multi-stepping are
+ * spread evenly over the interval. Axes stepping on the same event share a pulse.
+ */
+//#define STEP_EVENT_SCHEDULE
+#if ENABLED(STEP_EVENT_SCHEDULE)
+  #define STEP_SCHEDULE_SIZE     64   // Events in the schedule (power of 2, 16-128)
+  #define STEP_SCHEDULE_HORIZON 400   // (µs) Time to compute ahead of the step pulses
+  #define STEP_SCHEDULE_CHUNK    16   // Step events computed per Stepper ISR, bounding its run time (1-64)
+#endif
+
+/**
+ * Fixed-point Trapezoids
+ * Calculate the acceleration and deceleration steps of each planner block with
+ * integer math instead of float. On CPUs without an FPU (AVR, STM32F1) this makes
+ * re-planning faster, helping to keep the buffer full with short, fast segments.
+ * New blocks also get their per-axis acceleration limits and acceleration rate
+ * with integer math.
+ * Results can differ from the float calculation by a step due to float rounding.
+ * With MARLIN_DEV_MODE use D7 to compare both over a set of random moves. D7
+ * reports "match" when no move differs by more than that one step.
+ */
+//#define FIXED_POINT_TRAPEZOIDS
+
+/**
+ * Input Shaping
+ * Cancel the ringing of the X and Y axes at their resonant frequency so
+ * higher accelerations can be used without ripples on the print surface.
+ * Each step is split into impulses that are output at set delays. Their
+ * timing and size come from the frequency and damping ratio of the axis.
+ *
+ * Shaper types:
+ *   SHAPER_ZV  : 2 impulses over 1/2 period. Shortest delay, needs an exact frequency.
+ *   SHAPER_ZVD : 3 impulses over 1 period. Tolerates frequency errors.
+ *   SHAPER_MZV : 3 impulses over 3/4 period. A middle ground.
+ *
+ * Measure the frequency by printing a ringing tower, or with an accelerometer.
+ * Homing is done without shaping.
+ *
+ * On COREXY/COREYX both motors move X and Y, so both axes must be shaped alike.
+ * Enable both and give them the same settings. M593 sets both at once.
+ * On AVR keep the step buffers within 2K of SRAM. Each shaped axis uses
+ * 5 * SHAPING_MAX_STEPRATE / SHAPING_MIN_FREQ bytes.
+ *
+ *   M593 [X] [Y] F<Hz> D<zeta> T<type> : Set the shaper (F0 turns it off)
+ *   M593                               : Report the shapers
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40          // (Hz) The resonant frequency of the X axis. 0 = off.
+    #define SHAPING_ZETA_X  0.15f       // Damping ratio of the X axis (range: 0.0 = no damping to 1.0 = critical damping).
+    #define SHAPING_TYPE_X  SHAPER_ZV
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40          // (Hz) The resonant frequency of the Y axis. 0 = off.
+    #define SHAPING_ZETA_Y  0.15f       // Damping ratio of the Y axis (range: 0.0 = no damping to 1.0 = critical damping).
+    #define SHAPING_TYPE_Y  SHAPER_ZV
+  #endif
+  #define SHAPING_MIN_FREQ      20      // (Hz) Lowest settable frequency. Lower needs more SRAM.
+  #define SHAPING_MAX_STEPRATE  10000   // (steps/s) Highest step rate of one axis without loss of shaping. Higher needs more SRAM.
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1190,6 +1272,42 @@
     #define PE_LEDS_COMPLETED_TIME  (30*60) // (seconds) Time to keep the LED "done" color before restoring normal illumination
   #endif
 
+  /**
+   * SD Read-Ahead
+   *
+   * Read the file being printed in whole blocks with a multiple block read
+   * (CMD18), keeping the next blocks buffered ahead of the G-code parser.
+   * Blocks are fetched during idle time, so reaching the end of a block no
+   * longer stalls the main loop on the card. Uses 512 bytes of RAM per block.
+   * Not for SDIO or USB flash drives.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 2  // Number of 512 byte buffers (2-8)
+  #endif
+
+  /**
+   * Map the cluster chain of the file being printed when it is opened, so
+   * reads and seeks (M26, power-loss resume) don't have to look up the FAT.
+   * Each extent is a run of contiguous clusters and uses 8 bytes of RAM.
+   * A chain with more runs than this is only mapped up to that point.
+   */
+  //#define SD_CLUSTER_CACHE
+  #if ENABLED(SD_CLUSTER_CACHE)
+    #define SD_CLUSTER_CACHE_EXTENTS 16
+  #endif
+
+  /**
+   * Read and clean up lines of the file being printed ahead of the command
+   * queue, during idle time. Comments, blank lines, and leading and trailing
+   * spaces are dropped, so they don't use queue slots or main loop time when
+   * the queue has room. Lines are stored end-to-end in a buffer.
+   */
+  //#define SD_PREFETCH_COMMANDS
+  #if ENABLED(SD_PREFETCH_COMMANDS)
+    #define SD_PREFETCH_BYTES 256   // Buffer size. At least MAX_CMD_SIZE + 4.
+  #endif
+
   /**
    * Continue after Power-Loss (Creality3D)
    *
@@ -1213,6 +1331,14 @@
     // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+    // Append only the changing state (position, temperatures, fans, SD position) as small
+    // records, and rewrite the whole recovery file when it's full or other state changes.
+    // Saves are quicker and cause less SD card wear, so they can be more frequent.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SIZE 32 // Records between full rewrites (1-255)
+    #endif
   #endif
 
   /**
@@ -1253,6 +1379,27 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
+  /**
+   * Keep an index file (INDEX.MDX) in each folder listing its items with their
+   * long names, sizes, dates, and sort order. The index is checked against the
+   * folder's directory entries and rebuilt only when the folder has changed, so
+   * counting, selecting, and sorting items doesn't re-read the whole folder.
+   * Best with big folders and SDSORT_USES_RAM disabled.
+   */
+  //#define SD_DIR_INDEX
+
+  /**
+   * Paged listing of the working folder with 'M20 S<index> C<count>' so hosts can
+   * browse a big card a page at a time instead of waiting for the whole tree.
+   * Items are listed in folder order with their index, size, DOS name and long
+   * name, for the host to sort. Add 'B' to get each page as fixed-size binary
+   * records in base64. Pages are read from the SD_DIR_INDEX folder index if enabled.
+   */
+  //#define SD_PAGED_LISTING
+  #if ENABLED(SD_PAGED_LISTING)
+    #define SD_LISTING_PAGE 16  // Most items in one page
+  #endif
+
   // This allows hosts to request long names for files and folders with M33
   //#define LONG_FILENAME_HOST_SUPPORT
 
@@ -1331,6 +1478,15 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    // Also accept packets of pre-parsed G-code for the command queue, acknowledged
+    // per packet instead of per line. Requires FASTER_GCODE_PARSER.
+    //#define BINARY_GCODE_STREAM
+    #if ENABLED(BINARY_GCODE_STREAM)
+      #define BINARY_STREAM_PACKET_SIZE 256 // (bytes) Largest packet, for G-code and file data
+      #define BINARY_STREAM_WINDOW        4 // Packets the host may send before the first one is acknowledged
+    #endif
+  #endif
 
   /**
    * Set this option to one of the following (or the board's defaults apply):
@@ -1800,6 +1956,9 @@
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
+  //#define ARC_MAX_CHORD_ERROR 0.01 // (mm) Use radius to choose segment length, keeping chords this close to the arc (MM_PER = Min)
+  //#define ARC_PLANNER_BLOCKS      // Queue each XY arc as one planner block, stepped along its segments by the Stepper ISR (32-bit)
+                                    // Arcs fall back to line segments while bed leveling is active
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
@@ -1809,6 +1968,22 @@
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
 
+/**
+ * Adaptive Kinematic Segments
+ *
+ * DELTA and SCARA moves are normally split at a fixed rate (M665 S), but the
+ * nozzle only follows the straight line at the ends of each segment. Enable this
+ * to split moves only where the path between segment ends would stray from the
+ * line, giving long segments where the kinematics are nearly linear and short
+ * ones where they curve, such as near the edge of a delta's build area.
+ */
+//#define ADAPTIVE_KINEMATIC_SEGMENTS
+#if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+  #define KINEMATIC_SEGMENT_ERROR      0.01 // (mm) Largest allowed deviation from the straight line
+  #define KINEMATIC_SEGMENT_MIN_LENGTH 0.1  // (mm) Shortest segment, to limit the planner load
+  #define KINEMATIC_SEGMENT_MAX_LENGTH 10   // (mm) Longest segment, also the spacing of leveling corrections
+#endif
+
 /**
  * Direct Stepping
  *
@@ -1905,6 +2080,14 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+// Store queued commands end-to-end in a pool of COMMAND_QUEUE_BYTES instead
+// of BUFSIZE slots of MAX_CMD_SIZE bytes. Typical lines are much shorter than
+// MAX_CMD_SIZE, so BUFSIZE can be raised without using more RAM.
+//#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define COMMAND_QUEUE_BYTES 384   // At least 2 * MAX_CMD_SIZE. Each of the BUFSIZE commands also uses 2 bytes.
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2533,6 +2716,8 @@
     #define CURRENT_STEP_DOWN     50  // [mA]
     #define REPORT_CURRENT_CHANGE
     #define STOP_ON_ERROR
+    //#define TMC_ASYNC_STATUS        // Read driver status in the background, a poll interval ahead. UART drivers on a
+                                    // hardware serial port don't wait for replies. Chained SPI drivers are read in one pass.
   #endif
 
   /**
@@ -2626,6 +2811,18 @@
    */
   //#define TMC_DEBUG
 
+  /**
+   * Stream driver load data for tuning currents and speeds.
+   * M919 S<ms> samples StallGuard, CS_ACTUAL and DRV_STATUS at a fixed
+   * rate while moving, along with the planner block and step position.
+   * Samples are sent as binary frames on the port that sent M919.
+   * M919 S0 to stop.
+   */
+  //#define TMC_TELEMETRY
+  #if ENABLED(TMC_TELEMETRY)
+    #define TMC_TELEMETRY_BUFFER 32   // Samples held while waiting to be sent
+  #endif
+
   /**
    * You can set your own advanced settings by filling in predefined functions.
    * A list of available functions can be found on the library github page
@@ -3013,7 +3210,9 @@
       /**
        * Continuously calculate the current power (nominal_power * current_rate / nominal_rate).
        * Required for accurate power with non-trapezoidal acceleration (e.g., S_CURVE_ACCELERATION).
-       * This is a costly calculation so this option is discouraged on 8-bit AVR boards.
+       * Keeps the energy per mm constant through acceleration, so short vectors don't over-burn at corners.
+       * The planner stores the power per step rate in fixed-point, so each update is one multiply.
+       * With MARLIN_DEV_MODE use D10 to check the energy per mm along a move.
        *
        * LASER_POWER_INLINE_TRAPEZOID_CONT_PER defines how many step cycles there are between power updates. If your
        * board isn't able to generate steps fast enough (and you are using LASER_POWER_INLINE_TRAPEZOID_CONT), increase this.
@@ -3028,6 +3227,12 @@
        */
       //#define LASER_POWER_INLINE_TRAPEZOID_CONT_PER 10
 
+      /**
+       * Lowest power (0-255 PWM) for the speed trapezoid to scale down to, for lasers that
+       * won't fire below some level. Moves with less power than this keep their own power.
+       */
+      //#define LASER_POWER_INLINE_TRAPEZOID_FLOOR 10
+
       /**
        * Include laser power in G0/G1/G2/G3/G5 commands with the 'S' parameter
        */
@@ -3058,6 +3263,24 @@
        */
       //#define LASER_POWER_INLINE_CONTINUOUS
 
+      /**
+       * Raster Engraving
+       * Engrave a line of pixels with one move, changing the laser power in step
+       * with the motion. This is much faster than a G1 command for each pixel.
+       *
+       *   M580 <base64>          : Add pixels (0-255) to the next raster line
+       *   G7 X<pos> Y<pos> S<pwr> : Engrave the raster line over the move (S = full pixel power)
+       *
+       * Each pixel covers the same distance, so add run-in and run-out moves
+       * to have the whole line engraved at constant speed.
+       * Increase MAX_CMD_SIZE to send more pixels with each M580.
+       */
+      //#define LASER_RASTER
+      #if ENABLED(LASER_RASTER)
+        #define LASER_RASTER_PIXELS 512   // Most pixels in one raster line
+        #define LASER_RASTER_LINES    2   // Raster lines in the buffer. One is filled while the other is engraved.
+      #endif
+
     #else
 
       #define SPINDLE_LASER_POWERUP_DELAY     50 // (ms) Delay to allow the spindle/laser to come up to speed/power
@@ -3615,6 +3838,15 @@
   //#define SERVICE_INTERVAL_3    1 // print hours
 #endif
 
+/**
+ * Hardware CRC-16
+ * Use the MCU's CRC unit for the settings, mesh and power-loss checksums
+ * instead of the lookup table. Requires an STM32 with a programmable CRC
+ * polynomial (e.g., F0, F3, F7, G0, G4, H7, L4). Not STM32F1/F4.
+ * With MARLIN_DEV_MODE use D9 to compare the CRC implementations.
+ */
+//#define HARDWARE_CRC16
+
 // @section develop
 
 //
@@ -3634,3 +3866,32 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+
+/**
+ * Stepper ISR Profiling
+ * Measure the time spent in each phase of the Stepper ISR (in stepper timer ticks)
+ * and the work done by the planner to re-plan the buffer for each new block.
+ * D6 (requires MARLIN_DEV_MODE) runs canned move sequences and reports the cost
+ * of each phase and the maximum sustainable step rate for this configuration.
+ *   D6 S<sequence> C<count> F<feedrate>
+ *   S0 : Short zig-zag segments
+ *   S1 : Arc made of short chords
+ *   S2 : Long moves through the planner kinematics (for DELTA / SCARA)
+ *   S3 : Short extruding segments (exercises LIN_ADVANCE)
+ *   S4 : Straight line flooded with short segments (exercises the look-ahead)
+ * The linux_native_bench environment also writes every step edge to 'step_trace.bin'.
+ */
+//#define STEPPER_ISR_PROFILING
+
+/**
+ * Main Loop Profiling
+ * Measure the time (in microseconds) spent in each part of idle() and the
+ * main loop, and in each G-code handler. Handler times include any waiting
+ * they do, and the time of nested idle() calls is also counted in its parts.
+ *   M990     : Report count, min, avg, max and a histogram for each item
+ *   M990 R   : Reset the counts
+ */
+//#define LOOP_PROFILING
+#if ENABLED(LOOP_PROFILING)
+  #define LOOP_PROFILE_GCODES 16  // Number of different G-codes to time
+#endif
@@ -556,6 +556,17 @@ void MarlinSerial<Cfg>::flushTX() {
   }
 }
 
+#if HAS_DGUS_LCD || ENABLED(TMC_TELEMETRY)
+  template<typename Cfg>
+  typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::get_tx_buffer_free() {
+    const ring_buffer_pos_t t = tx_buffer.tail,  // next byte to send.
+                            h = tx_buffer.head;  // next pos for queue.
+    int ret = t - h - 1;
+    if (ret < 0) ret += Cfg::TX_SIZE + 1;
+    return ret;
+  }
+#endif
+
 /**
  * Imports from print.h
  */
@@ -779,17 +790,6 @@ MarlinSerial<MarlinSerialCfg<SERIAL_PORT>> customizedSerial1;
   // Instantiate
   MarlinSerial<LCDSerialCfg<LCD_SERIAL_PORT>> lcdSerial;
 
-  #if HAS_DGUS_LCD
-    template<typename Cfg>
-    typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::get_tx_buffer_free() {
-      const ring_buffer_pos_t t = tx_buffer.tail,  // next byte to send.
-                              h = tx_buffer.head;  // next pos for queue.
-      int ret = t - h - 1;
-      if (ret < 0) ret += Cfg::TX_SIZE + 1;
-      return ret;
-    }
-  #endif
-
 #endif
 
 #endif // !USBCON && (UBRRH || UBRR0H || UBRR1H || UBRR2H || UBRR3H)
@@ -47,6 +47,11 @@
   #define PGMSTR(NAM,STR) const char NAM[] = STR
 #endif
 
+// Microseconds for profiling code
+#ifndef HAL_PROFILE_MICROS
+  #define HAL_PROFILE_MICROS() micros()
+#endif
+
 inline void watchdog_refresh() {
   TERN_(USE_WATCHDOG, HAL_watchdog_refresh());
 }
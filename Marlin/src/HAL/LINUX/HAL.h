@@ -51,6 +51,9 @@ uint8_t _getc();
 
 #include "hardware/Clock.h"
 
+// Profile by host CPU time, since virtual time stands still while code runs
+#define HAL_PROFILE_MICROS() uint32_t(Clock::hostNanos() / 1000)
+
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
 #include "../shared/HAL_SPI.h"
@@ -103,6 +106,9 @@ inline uint8_t HAL_get_reset_source(void) { return RST_POWER_ON; }
 
 inline void HAL_reboot() {}  // reboot the board or restart the bootloader
 
+// No hardware PWM timers to adjust (see inc/SanityCheck.h)
+inline void set_pwm_frequency(const pin_t, int) {}
+
 /* ---------------- Delay in cycles */
 FORCE_INLINE static void DELAY_CYCLES(uint64_t x) {
   Clock::delayCycles(x);
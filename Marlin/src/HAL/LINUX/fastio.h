@@ -39,6 +39,8 @@
 #define READ_PIN(IO)          Gpio::get(IO)
 #define WRITE_PIN(IO,V)       Gpio::set(IO, V)
 
+#define NO_COMPILE_TIME_PWM   // PWM_PIN() is a function (see pinmapping.cpp)
+
 /**
  * Magic I/O routines
  *
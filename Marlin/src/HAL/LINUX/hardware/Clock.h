@@ -24,6 +24,13 @@
 #include <chrono>
 #include <thread>
 
+/**
+ * VIRTUAL_TIME_SIMULATION replaces the wall clock with a discrete-event clock.
+ * Time only moves when the firmware waits on it, jumping straight to the next
+ * timer deadline, so a long print can be replayed much faster than real time.
+ * See Timer::runNext() / Timer::runUntil() for the event dispatch.
+ */
+
 class Clock {
 public:
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
@@ -45,8 +52,17 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
-    auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-    return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
+    #ifdef VIRTUAL_TIME_SIMULATION
+      return Clock::virtual_nanos;
+    #else
+      auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
+      return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
+    #endif
+  }
+
+  // Host time, unaffected by time acceleration or virtual time
+  static uint64_t hostNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
   }
 
   static uint64_t micros() {
@@ -61,21 +77,51 @@ public:
     return Clock::nanos() / 1000000000.0;
   }
 
-  static void delayCycles(uint64_t cycles) {
-    std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
-  }
+  #ifdef VIRTUAL_TIME_SIMULATION
 
-  static void delayMicros(uint64_t micros) {
-    std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
-  }
+    // Move virtual time forward, servicing any timer deadlines on the way
+    static void advance(uint64_t ns);
 
-  static void delayMillis(uint64_t millis) {
-    std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
-  }
+    // Set virtual time without servicing timers (used by the event dispatcher)
+    static void setNanos(uint64_t ns) {
+      Clock::virtual_nanos = ns;
+    }
 
-  static void delaySeconds(double secs) {
-    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
-  }
+    static void delayCycles(uint64_t cycles) {
+      Clock::advance((1000000000ULL / frequency) * cycles);
+    }
+
+    static void delayMicros(uint64_t micros) {
+      Clock::advance(micros * 1000ULL);
+    }
+
+    static void delayMillis(uint64_t millis) {
+      Clock::advance(millis * 1000000ULL);
+    }
+
+    static void delaySeconds(double secs) {
+      Clock::advance(uint64_t(secs * 1000000000.0));
+    }
+
+  #else
+
+    static void delayCycles(uint64_t cycles) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
+    }
+
+    static void delayMicros(uint64_t micros) {
+      std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
+    }
+
+    static void delayMillis(uint64_t millis) {
+      std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
+    }
+
+    static void delaySeconds(double secs) {
+      std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
+    }
+
+  #endif
 
   // Will reduce timer resolution increasing likelihood of overflows
   static void setTimeMultiplier(double tm) {
@@ -86,4 +132,7 @@ private:
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
+  #ifdef VIRTUAL_TIME_SIMULATION
+    static uint64_t virtual_nanos;
+  #endif
 };
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "StepTraceLogger.h"
+
+StepTraceLogger::StepTraceLogger(std::string filename, std::initializer_list<pin_type> step_pins, std::initializer_list<pin_type> dir_pins) {
+  axis_count = 0;
+  for (pin_type p : step_pins) if (axis_count < max_axes) step_pin[axis_count++] = p;
+  uint8_t i = 0;
+  for (pin_type p : dir_pins) if (i < axis_count) dir_pin[i++] = p;
+  while (i < axis_count) dir_pin[i++] = -1;
+
+  last_time = Clock::nanos();
+  step_count = 0;
+
+  file.open(filename, std::ios::binary);
+  const char header[] = { 'S', 'T', 'P', 'T', 1, (char)axis_count };
+  file.write(header, sizeof(header));
+}
+
+StepTraceLogger::~StepTraceLogger() {
+  flush();
+  file.close();
+}
+
+void StepTraceLogger::record(uint32_t delta, uint8_t code) {
+  for (uint8_t b = 0; b < 4; b++) buffer.push_back(uint8_t(delta >> (b * 8)));
+  buffer.push_back(code);
+}
+
+void StepTraceLogger::log(GpioEvent ev) {
+  if (ev.event != GpioEvent::RISE) return;
+  for (uint8_t a = 0; a < axis_count; a++) {
+    if (ev.pin_id != step_pin[a]) continue;
+    uint64_t delta = ev.timestamp - last_time;
+    for (; delta > UINT32_MAX; delta -= UINT32_MAX) record(UINT32_MAX, gap_axis);
+    last_time = ev.timestamp;
+    record(uint32_t(delta), a | (Gpio::get(dir_pin[a]) ? 0x80 : 0));
+    step_count++;
+    break;
+  }
+}
+
+void StepTraceLogger::flush() {
+  if (buffer.empty()) return;
+  file.write((const char*)buffer.data(), buffer.size());
+  buffer.clear();
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <fstream>
+#include <vector>
+#include "Gpio.h"
+
+/**
+ * Binary step timeline. Logs the rising edge of every step pin along with
+ * the state of its direction pin, timestamped by the (virtual) clock.
+ *
+ * File layout (little-endian):
+ *   Header : "STPT", uint8_t version, uint8_t axis_count
+ *   Record : uint32_t ns since the previous record, uint8_t axis | (dir << 7)
+ * Gaps longer than a uint32_t are split using records with axis = 0x7F.
+ */
+class StepTraceLogger: public IOLogger {
+public:
+  static constexpr uint8_t max_axes = 8, gap_axis = 0x7F;
+
+  StepTraceLogger(std::string filename, std::initializer_list<pin_type> step_pins, std::initializer_list<pin_type> dir_pins);
+  virtual ~StepTraceLogger();
+  void flush();
+  void log(GpioEvent ev);
+
+  uint64_t steps() { return step_count; }
+
+private:
+  void record(uint32_t delta, uint8_t code);
+
+  std::ofstream file;
+  std::vector<uint8_t> buffer;
+  pin_type step_pin[max_axes], dir_pin[max_axes];
+  uint8_t axis_count;
+  uint64_t last_time, step_count;
+};
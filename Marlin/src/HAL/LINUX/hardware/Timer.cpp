@@ -24,6 +24,12 @@
 #include "Timer.h"
 #include <stdio.h>
 
+#ifdef VIRTUAL_TIME_SIMULATION
+  Timer* Timer::registry[Timer::max_timers];
+  uint8_t Timer::registered = 0;
+  bool Timer::in_isr = false;
+#endif
+
 Timer::Timer() {
   active = false;
   compare = 0;
@@ -34,8 +40,87 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  #ifdef VIRTUAL_TIME_SIMULATION
+    deadline = UINT64_MAX;
+  #endif
+}
+
+#ifdef VIRTUAL_TIME_SIMULATION
+
+Timer::~Timer() {}
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  frequency = sim_freq;
+  cbfn = fn;
+  if (registered < max_timers) registry[registered++] = this;
+}
+
+void Timer::start(uint32_t frequency) {
+  start_time = Clock::nanos();
+  setCompare(this->frequency / frequency);
 }
 
+void Timer::enable() { active = true; }
+
+void Timer::disable() { active = false; }
+
+/**
+ * Hardware timers in Marlin count up from the last compare match, so the
+ * deadline is always relative to the start of the current period. Calling
+ * this from inside the callback reprograms the period that just began.
+ */
+void Timer::setCompare(uint32_t compare) {
+  this->compare = compare;
+  period = Clock::ticksToNanos(compare, frequency);
+  deadline = start_time + period;
+}
+
+// Reading the counter is the only way an ISR busy-wait can observe time passing,
+// so charge one tick per read to guarantee forward progress.
+uint32_t Timer::getCount() {
+  Clock::setNanos(Clock::nanos() + Clock::ticksToNanos(1, frequency));
+  return Clock::nanosToTicks(Clock::nanos() - start_time, frequency);
+}
+
+void Timer::fire() {
+  start_time = deadline;
+  deadline = start_time + period;   // Periodic unless the callback reprograms it
+  in_isr = true;
+  cbfn();
+  in_isr = false;
+}
+
+Timer* Timer::earliest(uint64_t limit) {
+  Timer *next = nullptr;
+  for (uint8_t i = 0; i < registered; i++) {
+    Timer * const t = registry[i];
+    if (t->active && t->cbfn && t->deadline <= limit && (!next || t->deadline < next->deadline))
+      next = t;
+  }
+  return next;
+}
+
+bool Timer::runNext() {
+  if (in_isr) return false;
+  Timer * const t = earliest(UINT64_MAX);
+  if (!t) return false;
+  if (t->deadline > Clock::nanos()) Clock::setNanos(t->deadline);
+  t->fire();
+  return true;
+}
+
+void Timer::runUntil(uint64_t ns) {
+  if (!in_isr) {
+    while (Timer * const t = earliest(ns)) {
+      if (t->deadline > Clock::nanos()) Clock::setNanos(t->deadline);
+      t->fire();
+    }
+  }
+  if (ns > Clock::nanos()) Clock::setNanos(ns);
+}
+
+#else // !VIRTUAL_TIME_SIMULATION
+
 Timer::~Timer() {
   timer_delete(timerid);
 }
@@ -114,4 +199,6 @@ uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+#endif // !VIRTUAL_TIME_SIMULATION
+
 #endif // __PLAT_LINUX__
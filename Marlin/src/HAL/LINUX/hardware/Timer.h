@@ -52,6 +52,14 @@ public:
     return (*(intptr_t*)timerid);
   }
 
+  #ifdef VIRTUAL_TIME_SIMULATION
+    // Service the earliest pending timer, moving virtual time up to its deadline
+    static bool runNext();
+    // Service every timer due before 'ns', then leave virtual time at 'ns'
+    static void runUntil(uint64_t ns);
+    static bool inISR() { return in_isr; }
+  #endif
+
   static void handler(int sig, siginfo_t *si, void *uc){
     Timer* _this = (Timer*)si->si_value.sival_ptr;
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
@@ -73,4 +81,15 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+
+  #ifdef VIRTUAL_TIME_SIMULATION
+    uint64_t deadline;
+    void fire();
+    static Timer* earliest(uint64_t limit);
+
+    static constexpr uint8_t max_timers = 4;
+    static Timer* registry[max_timers];
+    static uint8_t registered;
+    static bool in_isr;
+  #endif
 };
@@ -32,8 +32,17 @@ extern void loop();
 #include <stdarg.h>
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
+#include "hardware/StepTraceLogger.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Timer.h"
+
+#ifdef VIRTUAL_TIME_SIMULATION
+  #include "../../gcode/queue.h"
+  #include "../../module/planner.h"
+
+  static bool input_finished = false; // Set when stdin reaches EOF
+#endif
 
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
@@ -56,28 +65,69 @@ void read_serial_thread() {
   }
 }
 
-void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+#ifdef VIRTUAL_TIME_SIMULATION
+
+  // Read stdin on the main thread so input arrives at the same virtual time on every run
+  bool read_serial_input() {
+    char buffer[255] = {};
+    bool got_input = false;
+    while (!input_finished) {
+      std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
+      if (len < 2) break;
+      if (!fgets(buffer, len, stdin)) { input_finished = true; break; }
+      for (std::size_t i = 0; i < strlen(buffer); i++)
+        usb_serial.receive_buffer.write(buffer[i]);
+      got_input = true;
+    }
+    return got_input;
+  }
+
+#endif
+
+class Simulation {
+public:
+  Heater hotend, bed;
+  LinearAxis x_axis, y_axis, z_axis, extruder0;
 
   //#define GPIO_LOGGING // Full GPIO and Positional Logging
+  //#define STEP_TRACE_LOGGING // Binary timeline of every step pulse in step_trace.bin (See StepTraceLogger.h)
 
   #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
-    Gpio::attachLogger(&logger);
-
+    #ifdef STEP_TRACE_LOGGING
+      #error "GPIO_LOGGING and STEP_TRACE_LOGGING cannot be used together."
+    #endif
+    IOLoggerCSV logger;
     std::ofstream position_log;
-    position_log.open("axis_position_log.csv");
+    int32_t x, y, z;
+  #endif
 
-    int32_t x,y,z;
+  #ifdef STEP_TRACE_LOGGING
+    StepTraceLogger step_trace;
   #endif
 
-  for (;;) {
+  Simulation()
+    : hotend(HEATER_0_PIN, TEMP_0_PIN), bed(HEATER_BED_PIN, TEMP_BED_PIN)
+    , x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN)
+    , y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN)
+    , z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN)
+    , extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC)
+    #ifdef GPIO_LOGGING
+      , logger("all_gpio_log.csv")
+    #endif
+    #ifdef STEP_TRACE_LOGGING
+      , step_trace("step_trace.bin", { X_STEP_PIN, Y_STEP_PIN, Z_STEP_PIN, E0_STEP_PIN }, { X_DIR_PIN, Y_DIR_PIN, Z_DIR_PIN, E0_DIR_PIN })
+    #endif
+  {
+    #ifdef GPIO_LOGGING
+      Gpio::attachLogger(&logger);
+      position_log.open("axis_position_log.csv");
+    #endif
+    #ifdef STEP_TRACE_LOGGING
+      Gpio::attachLogger(&step_trace);
+    #endif
+  }
 
+  void update() {
     hotend.update();
     bed.update();
 
@@ -99,13 +149,49 @@ void simulation_loop() {
       logger.flush();
     #endif
 
-    std::this_thread::yield();
+    #ifdef STEP_TRACE_LOGGING
+      step_trace.flush();
+    #endif
   }
-}
+};
+
+#ifdef VIRTUAL_TIME_SIMULATION
+
+  /**
+   * Discrete-event simulation. Everything runs on the main thread and the
+   * peripherals are serviced by a virtual timer, so results are repeatable
+   * and only limited by host CPU speed. Pipe a G-code file into stdin and
+   * the run ends once the file is consumed and all motion has completed.
+   */
+  #define SIMULATION_UPDATE_FREQUENCY 500 // (Hz) Heater model expects >1ms between updates
+
+  static Simulation *simulation;
+  static Timer simulation_timer;
+
+  void simulation_tick() { simulation->update(); }
+
+  bool simulation_finished() {
+    return input_finished && !usb_serial.receive_buffer.available()
+        && !queue.has_commands_queued() && !planner.has_blocks_queued();
+  }
+
+#else
+
+  void simulation_loop() {
+    Simulation simulation;
+    for (;;) {
+      simulation.update();
+      std::this_thread::yield();
+    }
+  }
+
+#endif
 
 int main() {
   std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+  #ifndef VIRTUAL_TIME_SIMULATION
+    std::thread read_serial (read_serial_thread);
+  #endif
 
   #ifdef MYSERIAL0
     MYSERIAL0.begin(BAUDRATE);
@@ -118,19 +204,49 @@ int main() {
 
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
+  #ifdef VIRTUAL_TIME_SIMULATION
 
-  DELAY_US(10000);
+    simulation = new Simulation();
+    simulation_timer.init(2, 1000000, simulation_tick);
+    simulation_timer.start(SIMULATION_UPDATE_FREQUENCY);
+    simulation_timer.enable();
 
-  setup();
-  for (;;) {
-    loop();
-    std::this_thread::yield();
-  }
+    DELAY_US(10000);
+
+    setup();
+    while (!simulation_finished()) {
+      loop();
+      if (!read_serial_input())
+        Timer::runNext(); // Nothing left to do until the next ISR
+    }
+
+    SERIAL_FLUSHTX();
+    while (usb_serial.transmit_buffer.available()) std::this_thread::yield();
+    fprintf(stderr, "Simulation complete: %.3f s virtual time\n", Clock::seconds());
+    delete simulation; // Flush logs
+    fflush(stdout);
+    exit(0);
+
+  #else
+
+    std::thread simulation (simulation_loop);
+
+    DELAY_US(10000);
+
+    setup();
+    for (;;) {
+      loop();
+      std::this_thread::yield();
+    }
+
+    simulation.join();
+
+  #endif
 
-  simulation.join();
   write_serial.join();
-  read_serial.join();
+  #ifndef VIRTUAL_TIME_SIMULATION
+    read_serial.join();
+  #endif
 }
 
 #endif // __PLAT_LINUX__
@@ -93,5 +93,8 @@ void HAL_timer_enable_interrupt(const uint8_t timer_num);
 void HAL_timer_disable_interrupt(const uint8_t timer_num);
 bool HAL_timer_interrupt_enabled(const uint8_t timer_num);
 
+// Profile ISRs by host CPU time, since virtual time stands still inside them
+#define HAL_PROFILE_TICKS() hal_timer_t(Clock::nanosToTicks(Clock::hostNanos(), STEPPER_TIMER_RATE))
+
 #define HAL_timer_isr_prologue(TIMER_NUM)
 #define HAL_timer_isr_epilogue(TIMER_NUM)
@@ -124,6 +124,31 @@ extern "C" {
 void HAL_adc_start_conversion(const uint8_t adc_pin) { HAL_adc_result = analogRead(adc_pin); }
 uint16_t HAL_adc_get_result() { return HAL_adc_result; }
 
+// ------------------------
+// CRC
+// ------------------------
+
+#if ENABLED(HARDWARE_CRC16)
+
+  // CRC-16/XMODEM, the same as crc16(). The unit is set up on every
+  // call so the initial value can carry on from the previous block.
+  void HAL_crc16(uint16_t *crc, const void * const data, uint16_t cnt) {
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->POL = 0x1021;
+    CRC->INIT = *crc;
+    CRC->CR = CRC_CR_POLYSIZE_0 | CRC_CR_RESET;   // 16-bit polynomial, no bit reversal, load INIT
+    const uint8_t *ptr = (const uint8_t *)data;
+    for (; cnt >= 4; cnt -= 4, ptr += 4) {         // Words are fed MSB first, so swap to keep byte order
+      uint32_t w;
+      memcpy(&w, ptr, sizeof(w));
+      CRC->DR = __REV(w);
+    }
+    while (cnt--) *(__IO uint8_t *)&CRC->DR = *ptr++;
+    *crc = uint16_t(CRC->DR);
+  }
+
+#endif
+
 // Reset the system (to initiate a firmware flash)
 void flashFirmware(const int16_t) { NVIC_SystemReset(); }
 
@@ -168,6 +168,16 @@ void HAL_adc_start_conversion(const uint8_t adc_pin);
 
 uint16_t HAL_adc_get_result();
 
+//
+// CRC
+//
+
+// Families whose CRC unit has a programmable polynomial can do CRC-16
+#ifdef CRC_POL_POL
+  #define HAL_CRC16 1
+  void HAL_crc16(uint16_t *crc, const void * const data, uint16_t cnt);
+#endif
+
 #define GET_PIN_MAP_PIN(index) index
 #define GET_PIN_MAP_INDEX(pin) pin
 #define PARSED_PIN_INDEX(code, dval) parser.intval(code, dval)
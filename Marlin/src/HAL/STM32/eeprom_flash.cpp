@@ -90,6 +90,73 @@
   static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
   static int current_slot = -1;
 
+  static bool erase_sector() {
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError = 0;
+
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    EraseInitStruct.Sector = FLASH_SECTOR;
+    EraseInitStruct.NbSectors = 1;
+
+    bool flash_unlocked = false;
+    UNLOCK_FLASH();
+
+    PAUSE_SERVO_OUTPUT();
+    DISABLE_ISRS();
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+    ENABLE_ISRS();
+    RESUME_SERVO_OUTPUT();
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPAIR("HAL_FLASHEx_Erase=", status);
+      DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPAIR("SectorError=", SectorError);
+    }
+    LOCK_FLASH();
+    return status == HAL_OK;
+  }
+
+  static bool program_words(uint32_t address, const uint8_t *data, const size_t size) {
+    bool flash_unlocked = false;
+    UNLOCK_FLASH();
+
+    bool success = true;
+    for (const uint32_t address_end = address + size; address < address_end; address += sizeof(uint32_t), data += sizeof(uint32_t)) {
+      uint32_t word;
+      memcpy(&word, data, sizeof(uint32_t));
+      const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, word);
+      if (status != HAL_OK) {
+        DEBUG_ECHOLNPAIR("HAL_FLASH_Program=", status);
+        DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
+        DEBUG_ECHOLNPAIR("address=", address);
+        success = false;
+        break;
+      }
+    }
+
+    LOCK_FLASH();
+    return success;
+  }
+
+  #if ENABLED(FLASH_EEPROM_LOG)
+
+    #include "../shared/eeprom_log.h"
+
+    static uint8_t eeprom_dirty[EEPROM_LOG_DIRTY_SIZE(MARLIN_EEPROM_SIZE)];
+
+    static_assert(0 == MARLIN_EEPROM_SIZE % (EEPROM_LOG_SECTION), "MARLIN_EEPROM_SIZE must be a multiple of EEPROM_LOG_SECTION");
+    static_assert(0 == sizeof(eeprom_log_record_t) % 4, "EEPROM_LOG_SECTION must be a multiple of 4");
+    static_assert(FLASH_UNIT_SIZE >= 2 * (MARLIN_EEPROM_SIZE / (EEPROM_LOG_SECTION)) * sizeof(eeprom_log_record_t), "FLASH_UNIT_SIZE is too small for FLASH_EEPROM_LOG");
+
+    const uint8_t* eeprom_log_flash() { return (const uint8_t*)FLASH_ADDRESS_START; }
+    size_t eeprom_log_capacity() { return FLASH_UNIT_SIZE; }
+    bool eeprom_log_erase() { return erase_sector(); }
+    bool eeprom_log_program(const uint32_t offset, const void * const data, const size_t size) {
+      return program_words(FLASH_ADDRESS_START + offset, (const uint8_t*)data, size);
+    }
+
+  #endif
+
   static_assert(0 == MARLIN_EEPROM_SIZE % 4, "MARLIN_EEPROM_SIZE must be a multiple of 4"); // Ensure copying as uint32_t is safe
   static_assert(0 == FLASH_UNIT_SIZE % MARLIN_EEPROM_SIZE, "MARLIN_EEPROM_SIZE must divide evenly into your FLASH_UNIT_SIZE");
   static_assert(FLASH_UNIT_SIZE >= MARLIN_EEPROM_SIZE, "FLASH_UNIT_SIZE must be greater than or equal to your MARLIN_EEPROM_SIZE");
@@ -107,7 +174,19 @@ size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 bool PersistentStore::access_start() {
 
-  #if ENABLED(FLASH_EEPROM_LEVELING)
+  #if ENABLED(FLASH_EEPROM_LOG)
+
+    if (current_slot == -1 || eeprom_data_written) {
+      // Rebuild the RAM copy from the log on first access or after a dangling write_data
+      if (eeprom_data_written) DEBUG_ECHOLN("Dangling EEPROM write_data");
+      memset(ram_eeprom, EMPTY_UINT8, sizeof(ram_eeprom));
+      eeprom_log_load(ram_eeprom, sizeof(ram_eeprom));
+      ZERO(eeprom_dirty);
+      current_slot = 0;
+      eeprom_data_written = false;
+    }
+
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
 
     if (current_slot == -1 || eeprom_data_written) {
       // This must be the first time since power on that we have accessed the storage, or someone
@@ -153,65 +232,22 @@ bool PersistentStore::access_finish() {
       __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
     #endif
 
-    #if ENABLED(FLASH_EEPROM_LEVELING)
+    #if ENABLED(FLASH_EEPROM_LOG)
 
-      HAL_StatusTypeDef status = HAL_ERROR;
-      bool flash_unlocked = false;
+      // Append only the changed sections
+      const bool success = eeprom_log_save(ram_eeprom, sizeof(ram_eeprom), eeprom_dirty);
+      if (success) eeprom_data_written = false;
+      return success;
+
+    #elif ENABLED(FLASH_EEPROM_LEVELING)
 
       if (--current_slot < 0) {
         // all slots have been used, erase everything and start again
-
-        FLASH_EraseInitTypeDef EraseInitStruct;
-        uint32_t SectorError = 0;
-
-        EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-        EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-        EraseInitStruct.Sector = FLASH_SECTOR;
-        EraseInitStruct.NbSectors = 1;
-
         current_slot = EEPROM_SLOTS - 1;
-        UNLOCK_FLASH();
-
-        PAUSE_SERVO_OUTPUT();
-        DISABLE_ISRS();
-        status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-        ENABLE_ISRS();
-        RESUME_SERVO_OUTPUT();
-        if (status != HAL_OK) {
-          DEBUG_ECHOLNPAIR("HAL_FLASHEx_Erase=", status);
-          DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
-          DEBUG_ECHOLNPAIR("SectorError=", SectorError);
-          LOCK_FLASH();
-          return false;
-        }
-      }
-
-      UNLOCK_FLASH();
-
-      uint32_t offset = 0;
-      uint32_t address = SLOT_ADDRESS(current_slot);
-      uint32_t address_end = address + MARLIN_EEPROM_SIZE;
-      uint32_t data = 0;
-
-      bool success = true;
-
-      while (address < address_end) {
-        memcpy(&data, ram_eeprom + offset, sizeof(uint32_t));
-        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, data);
-        if (status == HAL_OK) {
-          address += sizeof(uint32_t);
-          offset += sizeof(uint32_t);
-        }
-        else {
-          DEBUG_ECHOLNPAIR("HAL_FLASH_Program=", status);
-          DEBUG_ECHOLNPAIR("GetError=", HAL_FLASH_GetError());
-          DEBUG_ECHOLNPAIR("address=", address);
-          success = false;
-          break;
-        }
+        if (!erase_sector()) return false;
       }
 
-      LOCK_FLASH();
+      const bool success = program_words(SLOT_ADDRESS(current_slot), ram_eeprom, MARLIN_EEPROM_SIZE);
 
       if (success) {
         eeprom_data_written = false;
@@ -246,6 +282,9 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
     #if ENABLED(FLASH_EEPROM_LEVELING)
       if (v != ram_eeprom[pos]) {
         ram_eeprom[pos] = v;
+        #if ENABLED(FLASH_EEPROM_LOG)
+          EEPROM_LOG_MARK(eeprom_dirty, pos);
+        #endif
         eeprom_data_written = true;
       }
     #else
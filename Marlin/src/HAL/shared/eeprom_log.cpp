@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ * Copyright (c) 2015-2016 Nico Tonnhofer wurstnase.reprap@gmail.com
+ * Copyright (c) 2016 Victor Perez victor_pv@hotmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(FLASH_EEPROM_LOG)
+
+#include "eeprom_log.h"
+#include "../../libs/crc16.h"
+
+#define ERASED_SECTION 0xFFFF
+
+static uint32_t log_end;   // Offset of the first free record
+static bool log_compact;   // Erase the log on the next save
+
+static uint16_t record_crc(const eeprom_log_record_t &rec) {
+  uint16_t crc = 0;
+  crc16(&crc, &rec.section, sizeof(rec.section));
+  crc16(&crc, rec.data, sizeof(rec.data));
+  return crc;
+}
+
+static bool is_blank(const uint8_t *data) {
+  LOOP_L_N(i, EEPROM_LOG_SECTION) if (data[i] != 0xFF) return false;
+  return true;
+}
+
+/**
+ * Copy every record into the image, in the order written, so each section
+ * ends up with its newest copy. Damaged records (e.g., cut off by a reset)
+ * are skipped. The log ends at the first erased record, and the rest of the
+ * area must be erased. If not, the log is rewritten on the next save.
+ */
+void eeprom_log_load(uint8_t * const image, const size_t size) {
+  const uint8_t * const flash = eeprom_log_flash();
+  const uint16_t sections = size / (EEPROM_LOG_SECTION);
+  for (log_end = 0; log_end + sizeof(eeprom_log_record_t) <= eeprom_log_capacity(); log_end += sizeof(eeprom_log_record_t)) {
+    const eeprom_log_record_t &rec = *(const eeprom_log_record_t*)(flash + log_end);
+    if (rec.section == ERASED_SECTION) break;
+    if (rec.section < sections && rec.crc == record_crc(rec))
+      memcpy(image + rec.section * (EEPROM_LOG_SECTION), rec.data, EEPROM_LOG_SECTION);
+    else
+      log_compact = true;
+  }
+  for (uint32_t i = log_end; !log_compact && i < eeprom_log_capacity(); i++)
+    if (flash[i] != 0xFF) log_compact = true;
+}
+
+/**
+ * Append a record for each dirty section. If they don't all fit, erase
+ * the log and write all the sections that aren't blank.
+ */
+bool eeprom_log_save(const uint8_t * const image, const size_t size, uint8_t * const dirty) {
+  const uint16_t sections = size / (EEPROM_LOG_SECTION);
+
+  uint16_t count = 0;
+  LOOP_L_N(s, sections) if (TEST(dirty[s >> 3], s & 7)) count++;
+  if (!count) return true;
+
+  const bool compact = log_compact || log_end + count * sizeof(eeprom_log_record_t) > eeprom_log_capacity();
+  if (compact) {
+    if (!eeprom_log_erase()) return false;
+    log_end = 0;
+    log_compact = false;
+  }
+
+  eeprom_log_record_t rec;
+  LOOP_L_N(s, sections) {
+    const uint8_t * const data = image + s * (EEPROM_LOG_SECTION);
+    if (compact ? is_blank(data) : !TEST(dirty[s >> 3], s & 7)) continue;
+    rec.section = s;
+    memcpy(rec.data, data, sizeof(rec.data));
+    rec.crc = record_crc(rec);
+    const bool ok = eeprom_log_program(log_end, &rec, sizeof(rec));
+    log_end += sizeof(rec); // Never reuse a record that may be half-written
+    if (!ok) { log_compact = true; return false; }
+  }
+
+  memset(dirty, 0, EEPROM_LOG_DIRTY_SIZE(size));
+  return true;
+}
+
+#endif // FLASH_EEPROM_LOG
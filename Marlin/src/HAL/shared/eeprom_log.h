@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ * Copyright (c) 2015-2016 Nico Tonnhofer wurstnase.reprap@gmail.com
+ * Copyright (c) 2016 Victor Perez victor_pv@hotmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Log-structured storage for flash-emulated EEPROM
+ *
+ * The EEPROM image is kept in RAM and split into sections. Writes mark the
+ * sections they change, and a save appends only those sections to the log
+ * as CRC-checked records. At startup the log is replayed so every section
+ * gets its newest record. Flash is only erased when the log is full, and
+ * then all sections are written again.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef EEPROM_LOG_SECTION
+  #define EEPROM_LOG_SECTION 32   // Bytes per section. A multiple of 4.
+#endif
+
+// One "dirty" bit per section
+#define EEPROM_LOG_DIRTY_SIZE(S) (((S) / (EEPROM_LOG_SECTION) + 7) / 8)
+#define EEPROM_LOG_MARK(D,P)     ((D)[(P) / (EEPROM_LOG_SECTION) / 8] |= 1 << ((P) / (EEPROM_LOG_SECTION) % 8))
+
+typedef struct {
+  uint16_t section;                 // Section number. 0xFFFF in erased flash.
+  uint16_t crc;                     // CRC16 of the section number and data
+  uint8_t data[EEPROM_LOG_SECTION];
+} eeprom_log_record_t;
+
+// Replay the log into a RAM image pre-filled with erased (0xFF) bytes
+void eeprom_log_load(uint8_t * const image, const size_t size);
+
+// Append the dirty sections of the RAM image to the log, compacting when full.
+// Return 'true' on success.
+bool eeprom_log_save(const uint8_t * const image, const size_t size, uint8_t * const dirty);
+
+//
+// Provided by the HAL
+//
+const uint8_t* eeprom_log_flash();  // Memory-mapped start of the log area
+size_t eeprom_log_capacity();       // Size of the log area in bytes
+bool eeprom_log_erase();            // Erase the whole log area. Return 'true' on success.
+bool eeprom_log_program(const uint32_t offset, const void * const data, const size_t size); // Program whole words. Return 'true' on success.
@@ -146,6 +146,12 @@
   #include "feature/tmc_util.h"
 #endif
 
+#if ENABLED(TMC_TELEMETRY)
+  #include "feature/tmc_telemetry.h"
+#endif
+
+#include "feature/loop_profile.h"
+
 #if HAS_CUTTER
   #include "feature/spindle_laser.h"
 #endif
@@ -491,7 +497,7 @@ void startOrResumeJob() {
  */
 inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
-  if (queue.length < BUFSIZE) queue.get_available_commands();
+  if (queue.length < BUFSIZE) PROFILE_LOOP_PHASE(COMMANDS, queue.get_available_commands());
 
   const millis_t ms = millis();
 
@@ -651,7 +657,7 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
   TERN_(TEMP_STAT_LEDS, handle_status_leds());
 
-  TERN_(MONITOR_DRIVER_STATUS, monitor_tmc_drivers());
+  TERN_(MONITOR_DRIVER_STATUS, PROFILE_LOOP_PHASE(TMC, monitor_tmc_drivers()));
 
   TERN_(MONITOR_L6470_DRIVER_STATUS, L64xxManager.monitor_driver());
 
@@ -696,12 +702,13 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
  *  - Handle Joystick jogging
  */
 void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
+  PROFILE_LOOP_START(IDLE);
 
   // Core Marlin activities
-  manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
+  PROFILE_LOOP_PHASE(INACTIVITY, manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep)));
 
   // Manage Heaters (and Watchdog)
-  thermalManager.manage_heater();
+  PROFILE_LOOP_PHASE(HEATER, thermalManager.manage_heater());
 
   // Max7219 heartbeat, animation, etc
   TERN_(MAX7219_DEBUG, max7219.idle_tasks());
@@ -709,6 +716,8 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) return;
 
+  PROFILE_LOOP_START(SENSORS);
+
   // Handle filament runout sensors
   TERN_(HAS_FILAMENT_SENSOR, runout.run());
 
@@ -733,12 +742,24 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
         if (endstops.tmc_spi_homing_check()) break;
   #endif
 
+  PROFILE_LOOP_END(SENSORS);
+  PROFILE_LOOP_START(MEDIA);
+
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Buffer the next blocks of the SD print file
+  TERN_(SD_READ_AHEAD, card.read_ahead());
+
+  // Parse the next lines of the SD print file
+  TERN_(SD_PREFETCH_COMMANDS, queue.sd_prefetch());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
+  PROFILE_LOOP_END(MEDIA);
+  PROFILE_LOOP_START(HOST);
+
   // Announce Host Keepalive state (if any)
   TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
 
@@ -748,8 +769,12 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Update the Beeper queue
   TERN_(USE_BEEPER, buzzer.tick());
 
+  PROFILE_LOOP_END(HOST);
+
   // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+  PROFILE_LOOP_PHASE(UI, TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update()));
+
+  PROFILE_LOOP_START(REPORTS);
 
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
@@ -763,6 +788,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
     }
   #endif
 
+  // Stream TMC driver load data
+  TERN_(TMC_TELEMETRY, tmc_telemetry.update());
+
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
     if (!gcode.autoreport_paused) {
@@ -783,6 +811,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   #if HAS_TFT_LVGL_UI
     LV_TASK_HANDLER();
   #endif
+
+  PROFILE_LOOP_END(REPORTS);
+  PROFILE_LOOP_END(IDLE);
 }
 
 /**
@@ -1319,6 +1350,8 @@ void setup() {
  */
 void loop() {
   do {
+    PROFILE_LOOP_START(LOOP);
+
     idle();
 
     #if ENABLED(SDSUPPORT)
@@ -1327,11 +1360,13 @@ void loop() {
       if (marlin_state == MF_SD_COMPLETE) finishSDPrinting();
     #endif
 
-    queue.advance();
+    PROFILE_LOOP_PHASE(ADVANCE, queue.advance());
 
     endstops.event_handler();
 
     TERN_(HAS_TFT_LVGL_UI, printer_state_polling());
 
+    PROFILE_LOOP_END(LOOP);
+
   } while (ENABLED(__AVR__)); // Loop forever on slower (AVR) boards
 }
@@ -340,7 +340,24 @@
     const float cart_xy_mm_2 = HYPOT2(total.x, total.y),
                 cart_xy_mm = SQRT(cart_xy_mm_2);                                     // Total XY distance
 
-    #if IS_KINEMATIC
+    #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+      // Mesh correction needs evenly spaced segments, so use the shortest adaptive segment for the whole move
+      const float cart_xyz_mm = SQRT(cart_xy_mm_2 + sq(total.z));
+      float shortest_mm = KINEMATIC_SEGMENT_MAX_LENGTH;
+      if (cart_xy_mm) {                                                              // Z-only moves are linear
+        const xyz_float_t dir = xyz_float_t(total) * RECIPROCAL(cart_xyz_mm);
+        xyz_pos_t pos = current_position;
+        for (float done_mm = 0, segment_mm = KINEMATIC_SEGMENT_MAX_LENGTH;;) {
+          const float remaining_mm = cart_xyz_mm - done_mm;
+          segment_mm = kinematic_segment_mm(pos, dir, remaining_mm, segment_mm);
+          if (segment_mm >= remaining_mm) break;
+          NOMORE(shortest_mm, segment_mm);
+          done_mm += segment_mm;
+          pos += dir * segment_mm;
+        }
+      }
+      uint16_t segments = CEIL(cart_xyz_mm / shortest_mm);
+    #elif IS_KINEMATIC
       const float seconds = cart_xy_mm / scaled_fr_mm_s;                             // Duration of XY move at requested rate
       uint16_t segments = LROUND(delta_segments_per_second * seconds),               // Preferred number of segments for distance @ feedrate
                seglimit = LROUND(cart_xy_mm * RECIPROCAL(DELTA_SEGMENT_MIN_LENGTH)); // Number of segments at minimum segment length
@@ -31,6 +31,13 @@ char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  char GCodeStreamProtocol::buffer[BINARY_STREAM_WINDOW][BINARY_STREAM_PACKET_SIZE];
+  uint16_t GCodeStreamProtocol::length[BINARY_STREAM_WINDOW];
+  uint8_t GCodeStreamProtocol::packet_sync[BINARY_STREAM_WINDOW], GCodeStreamProtocol::index_r, GCodeStreamProtocol::count;
+  char *GCodeStreamProtocol::next_command;
+#endif
+
 BinaryStream binaryStream[NUM_SERIAL];
 
 #endif
@@ -29,6 +29,11 @@
   #include "../libs/heatshrink/heatshrink_decoder.h"
 #endif
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  #include "../gcode/parser.h"
+  #include "../gcode/queue.h"
+#endif
+
 inline bool bs_serial_data_available(const uint8_t index) {
   switch (index) {
     case 0: return MYSERIAL0.available();
@@ -212,9 +217,116 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  /**
+   * G-code stream protocol
+   *
+   * A COMMANDS packet carries one or more commands for the command queue.
+   * Each one is a nul-terminated line of text or a pre-parsed command in the
+   * BINARY_COMMAND_MARK format (see parser.h), which skips text parsing.
+   *
+   * Up to BINARY_STREAM_WINDOW packets are held until their commands are queued.
+   * Each packet is acknowledged once all its commands have been queued, replacing
+   * the "ok" for each line. The host may send that many packets before the first
+   * is acknowledged, so it never has to wait for a round trip.
+   */
+  class GCodeStreamProtocol {
+  private:
+    static char buffer[BINARY_STREAM_WINDOW][BINARY_STREAM_PACKET_SIZE];
+    static uint16_t length[BINARY_STREAM_WINDOW];
+    static uint8_t packet_sync[BINARY_STREAM_WINDOW],
+                   index_r,       // The oldest held packet
+                   count;         // The number of held packets
+    static char *next_command;    // The next command to queue from the oldest packet
+
+    // The size of the command at 'p', or 0 if it's malformed
+    static uint8_t command_size(const char * const p, const char * const end) {
+      const uint16_t room = end - p;
+      if (*p == BINARY_COMMAND_MARK) {
+        if (room < 6) return 0;
+        const uint16_t size = BINARY_COMMAND_SIZE(p);
+        if (size > room || size > MAX_CMD_SIZE) return 0;
+        if (p[1] != 'G' && p[1] != 'M' && p[1] != 'T') return 0;
+        for (uint16_t i = 6; i < size; i += 5) if (!WITHIN(p[i], 'A', 'Z')) return 0;
+        return size;
+      }
+      const char * const nul = (const char*)memchr(p, '\0', room);
+      return nul && nul - p < MAX_CMD_SIZE ? nul - p + 1 : 0;
+    }
+
+  public:
+    enum class GCodeStream : uint8_t { QUERY, COMMANDS };
+
+    static void reset() { count = 0; }
+
+    // Is there room to receive another packet?
+    static bool has_room() { return count < BINARY_STREAM_WINDOW; }
+
+    // Are there packets with commands still to be queued?
+    static bool pending() { return count; }
+
+    // The buffer for the next packet to receive
+    static char* next_buffer() { return buffer[(index_r + count) % (BINARY_STREAM_WINDOW)]; }
+
+    // Validate a COMMANDS packet received into next_buffer() and hold it for queueing
+    static bool start(const uint8_t sync, const uint16_t size) {
+      if (!size || !has_room()) return false;
+      const uint8_t i = (index_r + count) % (BINARY_STREAM_WINDOW);
+      const char * const end = buffer[i] + size;
+      for (const char *p = buffer[i]; p < end;) {
+        const uint8_t cmd_size = command_size(p, end);
+        if (!cmd_size) return false;
+        p += cmd_size;
+      }
+      length[i] = size;
+      packet_sync[i] = sync;
+      if (!count++) next_command = buffer[i];
+      return true;
+    }
+
+    // Is 'sync' a held packet that hasn't been acknowledged yet?
+    static bool is_held(const uint8_t sync) {
+      for (uint8_t n = 0; n < count; n++)
+        if (packet_sync[(index_r + n) % (BINARY_STREAM_WINDOW)] == sync) return true;
+      return false;
+    }
+
+    // Queue as many commands as will fit, acknowledging each packet that gets fully queued
+    static void queue_commands() {
+      while (count) {
+        const char * const end = buffer[index_r] + length[index_r];
+        while (next_command < end) {
+          if (*next_command && *next_command != ';' && !queue.enqueue_stream(next_command)) return;
+          next_command += command_size(next_command, end);
+        }
+        SERIAL_ECHOLNPAIR("ok", packet_sync[index_r]);
+        index_r = (index_r + 1) % (BINARY_STREAM_WINDOW);
+        if (--count) next_command = buffer[index_r];
+      }
+    }
+
+    // Handle packets that aren't queued
+    static void process(const uint8_t packet_type) {
+      switch (static_cast<GCodeStream>(packet_type)) {
+        case GCodeStream::QUERY:
+          SERIAL_ECHOLNPAIR("PGS:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH,
+                            ":buffer:", MAX_CMD_SIZE, ":packet:", BINARY_STREAM_PACKET_SIZE, ":window:", BINARY_STREAM_WINDOW);
+          break;
+        default:
+          SERIAL_ECHOLNPGM("PGS:invalid");
+          break;
+      }
+    }
+
+    static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 2, VERSION_PATCH = 0;
+  };
+
+#endif // BINARY_GCODE_STREAM
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, GCODE };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -235,6 +347,12 @@ public:
       };
       uint8_t protocol() { return (meta >> 4) & 0xF; }
       uint8_t type() { return meta & 0xF; }
+      #if ENABLED(BINARY_GCODE_STREAM)
+        bool is_commands() {
+          return static_cast<Protocol>(protocol()) == Protocol::GCODE
+              && static_cast<GCodeStreamProtocol::GCodeStream>(type()) == GCodeStreamProtocol::GCodeStream::COMMANDS;
+        }
+      #endif
       void reset() { token = 0; sync = 0; meta = 0; size = 0; checksum = 0; }
       uint8_t data[2];
     };
@@ -269,6 +387,7 @@ public:
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    TERN_(BINARY_GCODE_STREAM, GCodeStreamProtocol::reset());
   }
 
   // fletchers 16 checksum
@@ -296,10 +415,16 @@ public:
     uint8_t data = 0;
     millis_t transfer_window = millis() + RX_TIMESLICE;
 
+    // G-code packets are held in their own buffers, which may be larger than the command buffer
+    constexpr size_t packet_size = TERN(BINARY_GCODE_STREAM, BINARY_STREAM_PACKET_SIZE, buffer_size);
+
     #if ENABLED(SDSUPPORT)
       PORT_REDIRECT(card.transfer_port_index);
     #endif
 
+    // Queue commands from held packets as the queue makes room
+    TERN_(BINARY_GCODE_STREAM, GCodeStreamProtocol::queue_commands());
+
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Warray-bounds"
 
@@ -312,6 +437,9 @@ public:
           packet.reset();
           stream_state = StreamState::PACKET_WAIT;
         case StreamState::PACKET_WAIT:
+          #if ENABLED(BINARY_GCODE_STREAM)
+            if (!GCodeStreamProtocol::has_room()) { idle(); return; } // all packet buffers are held, so leave data in the serial buffer
+          #endif
           if (!stream_read(data)) { idle(); return; }  // no active packet so don't wait
           packet.header.data[1] = data;
           if (packet.header.token == packet.header.HEADER_TOKEN) {
@@ -337,7 +465,7 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLNPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  SERIAL_ECHOLNPAIR("ss", sync, ",", packet_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
@@ -346,11 +474,19 @@ public:
                 packet.bytes_received = 0;
                 if (packet.header.size) {
                   stream_state = StreamState::PACKET_DATA;
-                  packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
+                  // multipacket buffering only for G-code packets, otherwise always allocate whole buffer to packet
+                  packet.buffer = TERN(BINARY_GCODE_STREAM, GCodeStreamProtocol::next_buffer(), static_cast<char *>(&buffer[0]));
                 }
                 else
                   stream_state = StreamState::PACKET_PROCESS;
               }
+              #if ENABLED(BINARY_GCODE_STREAM)
+                else if (uint8_t(sync - packet.header.sync) <= BINARY_STREAM_WINDOW) { // packet already received
+                  if (!GCodeStreamProtocol::is_held(packet.header.sync))  // ok response must have been lost
+                    SERIAL_ECHOLNPAIR("ok", packet.header.sync);
+                  stream_state = StreamState::PACKET_RESET;
+                }
+              #endif
               else if (packet.header.sync == sync - 1) {           // ok response must have been lost
                 SERIAL_ECHOLNPAIR("ok", packet.header.sync);  // transmit valid packet received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
@@ -373,7 +509,7 @@ public:
         case StreamState::PACKET_DATA:
           if (!stream_read(data)) break;
 
-          if (buffer_next_index < buffer_size)
+          if (buffer_next_index < packet_size)
             packet.buffer[buffer_next_index] = data;
           else {
             SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
@@ -406,10 +542,22 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
+          // Other packets wait for the G-code commands before them to be queued
+          if (TERN0(BINARY_GCODE_STREAM, !packet.header.is_commands() && GCodeStreamProtocol::pending())) return;
+
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
 
+          #if ENABLED(BINARY_GCODE_STREAM)
+            // G-code commands are acknowledged after they're all queued
+            if (packet.header.is_commands() && GCodeStreamProtocol::start(packet.header.sync, packet.header.size)) {
+              GCodeStreamProtocol::queue_commands();
+              stream_state = StreamState::PACKET_RESET;
+              break;
+            }
+          #endif
+
           SERIAL_ECHOLNPAIR("ok", packet.header.sync); // transmit valid packet received
           dispatch();
           stream_state = StreamState::PACKET_RESET;
@@ -454,6 +602,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_GCODE_STREAM)
+        case Protocol::GCODE:
+          GCodeStreamProtocol::process(packet.header.type()); // queries and invalid packets
+          break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/laser_raster.cpp - Pixel lines for laser raster engraving
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "laser_raster.h"
+#include "../module/planner.h"
+#include "../MarlinCore.h"
+
+LaserRaster laser_raster;
+
+uint8_t LaserRaster::pixels[LASER_RASTER_LINES][LASER_RASTER_PIXELS];
+uint16_t LaserRaster::length[LASER_RASTER_LINES];
+uint8_t LaserRaster::fill_line; // = 0
+bool LaserRaster::fresh = true;
+
+// A line is in use until the stepper is done with every block that engraves it
+bool LaserRaster::busy(const uint8_t line) {
+  for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1))
+    if (planner.block_buffer[b].laser.raster == line + 1) return true;
+  return false;
+}
+
+static int8_t base64_value(const char c) {
+  switch (c) {
+    case 'A' ... 'Z': return c - 'A';
+    case 'a' ... 'z': return c - 'a' + 26;
+    case '0' ... '9': return c - '0' + 52;
+    case '+': return 62;
+    case '/': return 63;
+    default: return -1;
+  }
+}
+
+bool LaserRaster::add_base64(const char *str) {
+  if (fresh) {
+    // Wait for the stepper to finish with an earlier use of the line
+    while (busy(fill_line)) idle();
+    length[fill_line] = 0;
+    fresh = false;
+  }
+
+  uint8_t * const line = pixels[fill_line];
+  uint16_t &len = length[fill_line];
+  uint16_t bits = 0;
+  uint8_t nbits = 0;
+  for (; *str; str++) {
+    const int8_t v = base64_value(*str);
+    if (v < 0) continue;      // Skip padding and spaces
+    bits = (bits << 6) | v;
+    nbits += 6;
+    if (nbits >= 8) {
+      nbits -= 8;
+      if (len >= LASER_RASTER_PIXELS) return false;
+      line[len++] = uint8_t(bits >> nbits);
+    }
+  }
+  return true;
+}
+
+uint8_t LaserRaster::queue_line() {
+  const uint8_t line = fill_line;
+  if (++fill_line >= LASER_RASTER_LINES) fill_line = 0;
+  fresh = true;
+  return line;
+}
+
+#endif // LASER_RASTER
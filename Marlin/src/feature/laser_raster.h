@@ -0,0 +1,54 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/laser_raster.h - Pixel lines for laser raster engraving
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class LaserRaster {
+public:
+  static uint8_t pixels[LASER_RASTER_LINES][LASER_RASTER_PIXELS];
+  static uint16_t length[LASER_RASTER_LINES];
+
+  // Decode base64 pixels onto the line being filled. Return 'false' if they don't fit.
+  static bool add_base64(const char *str);
+
+  // Drop the pixels of the line being filled
+  static inline void discard() { fresh = true; }
+
+  // Pixels are waiting for G7?
+  static inline bool pending() { return !fresh && length[fill_line]; }
+
+  // Hand the filled line to a move. Return its index for the planner.
+  static uint8_t queue_line();
+
+private:
+  static uint8_t fill_line;   // The line taking new pixels
+  static bool fresh;          // The fill line must be cleared before adding pixels
+
+  static bool busy(const uint8_t line);
+};
+
+extern LaserRaster laser_raster;
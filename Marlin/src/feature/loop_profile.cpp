@@ -0,0 +1,99 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LOOP_PROFILING)
+
+#include "loop_profile.h"
+
+LoopProfiler loop_profiler;
+
+loop_profile_t LoopProfiler::phase[LP_COUNT];
+gcode_profile_t LoopProfiler::gcode[LOOP_PROFILE_GCODES];
+uint8_t LoopProfiler::gcode_count; // = 0
+loop_profile_t LoopProfiler::gcode_other;
+
+void loop_profile_t::add(const uint32_t us) {
+  if (!count++ || us < min) min = us;
+  NOLESS(max, us);
+  total += us;
+  uint8_t b = 0;
+  for (uint32_t v = us >> 4; v && b < LOOP_PROFILE_BUCKETS - 1; v >>= 1) b++;
+  if (hist[b] < UINT16_MAX) hist[b]++;
+}
+
+void LoopProfiler::add_gcode(const char letter, const uint16_t codenum, const uint32_t us) {
+  LOOP_L_N(i, gcode_count)
+    if (gcode[i].letter == letter && gcode[i].codenum == codenum)
+      return gcode[i].time.add(us);
+
+  if (gcode_count < LOOP_PROFILE_GCODES) {
+    gcode_profile_t &g = gcode[gcode_count++];
+    g.letter = letter;
+    g.codenum = codenum;
+    g.time.add(us);
+  }
+  else
+    gcode_other.add(us);
+}
+
+void LoopProfiler::reset() {
+  LOOP_L_N(i, LP_COUNT) phase[i] = {};
+  LOOP_L_N(i, gcode_count) gcode[i].time = {};
+  gcode_count = 0;
+  gcode_other = {};
+}
+
+static void report_profile(const loop_profile_t &p) {
+  SERIAL_ECHOPAIR(" count:", p.count, " min:", p.min, " avg:", uint32_t(p.count ? p.total / p.count : 0), " max:", p.max, " hist:");
+  LOOP_L_N(i, LOOP_PROFILE_BUCKETS) {
+    if (i) SERIAL_CHAR(',');
+    SERIAL_ECHO(p.hist[i]);
+  }
+  SERIAL_EOL();
+}
+
+void LoopProfiler::report() {
+  // Names padded to 10 characters, in LoopPhase order
+  static PGMSTR(phase_names, "loop      \0idle      \0inactivity\0commands  \0tmc       \0heater    \0"
+                             "sensors   \0media     \0host      \0ui        \0reports   \0advance   ");
+  static_assert(sizeof(phase_names) == LP_COUNT * 11, "phase_names must have a name for each LoopPhase.");
+  SERIAL_ECHOLNPGM("Loop profile (us). Histogram: <16,<32,<64,<128,<256,<512,<1k,<2k,<4k,more");
+  LOOP_L_N(i, LP_COUNT) {
+    if (!phase[i].count) continue;
+    SERIAL_CHAR(' ');
+    serialprintPGM(&phase_names[i * 11]);
+    report_profile(phase[i]);
+  }
+  LOOP_L_N(i, gcode_count) {
+    SERIAL_CHAR(' ', gcode[i].letter);
+    SERIAL_ECHO(gcode[i].codenum);
+    report_profile(gcode[i].time);
+  }
+  if (gcode_other.count) {
+    SERIAL_ECHOPGM(" other");
+    report_profile(gcode_other);
+  }
+}
+
+#endif // LOOP_PROFILING
@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * loop_profile.h - Time spent in the parts of the main loop and G-code handlers
+ *
+ * Without LOOP_PROFILING the PROFILE_ macros do nothing.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LOOP_PROFILING)
+
+  enum LoopPhase : uint8_t {
+    LP_LOOP,        // One pass of loop()
+    LP_IDLE,        // All of idle()
+    LP_INACTIVITY,  // manage_inactivity()
+    LP_COMMANDS,    // Reading serial and SD commands (in manage_inactivity)
+    LP_TMC,         // TMC driver monitoring (in manage_inactivity)
+    LP_HEATER,      // thermalManager.manage_heater()
+    LP_SENSORS,     // Runout, HAL, network, power-loss and StallGuard checks
+    LP_MEDIA,       // SD and USB media
+    LP_HOST,        // Keepalive, print counter, beeper
+    LP_UI,          // Display and controller
+    LP_REPORTS,     // Auto-reports and other tasks at the end of idle()
+    LP_ADVANCE,     // queue.advance(), which runs the G-code handlers
+    LP_COUNT
+  };
+
+  // Histogram buckets: <16us, <32us, ... <4096us, and the rest
+  #define LOOP_PROFILE_BUCKETS 10
+
+  typedef struct {
+    uint32_t count, min, max;   // Microseconds
+    uint64_t total;             // A 32-bit sum of the loop phases wraps in about 72 minutes
+    uint16_t hist[LOOP_PROFILE_BUCKETS];
+    void add(const uint32_t us);
+  } loop_profile_t;
+
+  typedef struct {
+    char letter;
+    uint16_t codenum;
+    loop_profile_t time;
+  } gcode_profile_t;
+
+  class LoopProfiler {
+  public:
+    static loop_profile_t phase[LP_COUNT];
+    static void add_gcode(const char letter, const uint16_t codenum, const uint32_t us);
+    static void reset();
+    static void report();
+
+    // Time a G-code handler from here to the end of the scope
+    struct GcodeTimer {
+      const char letter;
+      const uint16_t codenum;
+      const uint32_t start_us;
+      GcodeTimer(const char l, const uint16_t c) : letter(l), codenum(c), start_us(micros()) {}
+      ~GcodeTimer() { add_gcode(letter, codenum, micros() - start_us); }
+    };
+
+  private:
+    static gcode_profile_t gcode[LOOP_PROFILE_GCODES];
+    static uint8_t gcode_count;
+    static loop_profile_t gcode_other;  // G-codes that didn't fit
+  };
+
+  extern LoopProfiler loop_profiler;
+
+  // Time one statement, or the statements between START and END
+  #define PROFILE_LOOP_PHASE(P, V...) do{ \
+    const uint32_t _us = micros(); \
+    V; \
+    loop_profiler.phase[LP_##P].add(micros() - _us); \
+  }while(0)
+  #define PROFILE_LOOP_START(P) const uint32_t _lp_us_##P = micros()
+  #define PROFILE_LOOP_END(P)   loop_profiler.phase[LP_##P].add(micros() - _lp_us_##P)
+
+  // Time the current G-code handler
+  #define PROFILE_GCODE() LoopProfiler::GcodeTimer _gcode_timer(parser.command_letter, parser.codenum)
+
+#else
+
+  #define PROFILE_LOOP_PHASE(P, V...) V
+  #define PROFILE_LOOP_START(P)
+  #define PROFILE_LOOP_END(P)
+  #define PROFILE_GCODE()
+
+#endif
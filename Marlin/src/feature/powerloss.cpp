@@ -44,6 +44,12 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint8_t PrintJobRecovery::journal_head,
+          PrintJobRecovery::journal_count;
+  uint16_t PrintJobRecovery::journal_crc;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -58,6 +64,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -121,6 +131,7 @@ void PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  TERN_(POWER_LOSS_JOURNAL, close());
   card.removeJobRecoveryFile();
 }
 
@@ -128,14 +139,50 @@ void PrintJobRecovery::purge() {
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
+  TERN_(POWER_LOSS_JOURNAL, close()); // The journal may be open for write
   if (exists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    // Files saved with and without POWER_LOSS_JOURNAL differ in layout and size
+    if (file.fileSize() == RECOVERY_FILE_SIZE) {
+      (void)file.read(&info, sizeof(info));
+      TERN_(POWER_LOSS_JOURNAL, load_journal());
+    }
+    else
+      init();
     close();
   }
   debug(PSTR("Load"));
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * Apply the journal records that follow the full record, in order,
+   * stopping at the first one that is empty, stale, or damaged.
+   */
+  void PrintJobRecovery::load_journal() {
+    if (!info.valid()) return;
+    job_recovery_journal_t rec;
+    LOOP_L_N(i, POWER_LOSS_JOURNAL_SIZE) {
+      if (file.read(&rec, sizeof(rec)) != sizeof(rec)) break;
+      uint16_t crc = 0;
+      crc16(&crc, &rec, offsetof(job_recovery_journal_t, data) + JOURNAL_DATA_SIZE);
+      if (rec.valid_head != info.valid_head || rec.index != i || rec.crc != crc) break;
+      memcpy((uint8_t*)&info + JOURNAL_DATA_START, rec.data, JOURNAL_DATA_SIZE);
+    }
+  }
+
+  /**
+   * CRC of the part of the info not saved in journal records
+   */
+  uint16_t PrintJobRecovery::base_crc() {
+    uint16_t crc = 0;
+    crc16(&crc, &info.axis_relative, offsetof(job_recovery_info_t, valid_foot) - offsetof(job_recovery_info_t, axis_relative));
+    return crc;
+  }
+
+#endif
+
 /**
  * Set info fields that won't change
  */
@@ -313,11 +360,50 @@ void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // If only the fast-changing state differs from the full record,
+    // append a journal record plus an empty one to end the journal.
+    const uint16_t crc = base_crc();
+    if (file.isOpen() && crc == journal_crc && journal_count < POWER_LOSS_JOURNAL_SIZE) {
+      job_recovery_journal_t rec[2];
+      rec[0].valid_head = journal_head;
+      rec[0].index = journal_count;
+      memcpy(rec[0].data, (uint8_t*)&info + JOURNAL_DATA_START, JOURNAL_DATA_SIZE);
+      rec[0].crc = 0;
+      crc16(&rec[0].crc, &rec[0], offsetof(job_recovery_journal_t, data) + JOURNAL_DATA_SIZE);
+      memset(&rec[1], 0, sizeof(rec[1]));
+      const uint8_t count = journal_count < POWER_LOSS_JOURNAL_SIZE - 1 ? 2 : 1;
+      file.seekSet(sizeof(info) + journal_count * sizeof(rec[0]));
+      if (file.write(rec, count * sizeof(rec[0])) == -1 || !file.sync()) DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+      journal_count++;
+      return;
+    }
+
+    // Otherwise write the full record, then keep the file open for the journal
+    if (!file.isOpen()) open(false);
+    journal_head = info.valid_head;
+    journal_count = 0;
+    journal_crc = crc;
+    job_recovery_journal_t empty;
+    memset(&empty, 0, sizeof(empty));
+    file.seekSet(0);
+    bool ok = file.write(&info, sizeof(info)) != -1 && file.write(&empty, sizeof(empty)) != -1;
+    // Fill a new file out to its full size, so appending a record never changes the
+    // file size and the sync only writes the data block, not the directory entry
+    while (ok && file.fileSize() < RECOVERY_FILE_SIZE)
+      ok = file.write(&empty, sizeof(empty)) != -1;
+    if (!ok || !file.sync()) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
 /**
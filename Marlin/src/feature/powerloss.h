@@ -49,6 +49,29 @@ typedef struct {
   xyze_pos_t current_position;
   float zraise;
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    //
+    // The state that changes with each save comes first, to be appended
+    // to the journal as a small record. Without the journal the fields
+    // keep their old places so existing recovery files still load.
+    //
+    uint16_t feedrate;
+    #if HAS_HOTEND
+      int16_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      int16_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    volatile uint32_t sdpos;
+    millis_t print_job_elapsed;
+
+    // State that rarely changes during a print
+    uint8_t axis_relative;
+  #endif
+
   #if HAS_HOME_OFFSET
     xyz_pos_t home_offset;
   #endif
@@ -56,7 +79,9 @@ typedef struct {
     xyz_pos_t position_shift;
   #endif
 
-  uint16_t feedrate;
+  #if DISABLED(POWER_LOSS_JOURNAL)
+    uint16_t feedrate;
+  #endif
 
   #if HAS_MULTI_EXTRUDER
     uint8_t active_extruder;
@@ -67,16 +92,18 @@ typedef struct {
     float filament_size[EXTRUDERS];
   #endif
 
-  #if HAS_HOTEND
-    int16_t target_temperature[HOTENDS];
-  #endif
+  #if DISABLED(POWER_LOSS_JOURNAL)
+    #if HAS_HOTEND
+      int16_t target_temperature[HOTENDS];
+    #endif
 
-  #if HAS_HEATED_BED
-    int16_t target_temperature_bed;
-  #endif
+    #if HAS_HEATED_BED
+      int16_t target_temperature_bed;
+    #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
   #endif
 
   #if HAS_LEVELING
@@ -97,15 +124,19 @@ typedef struct {
     #endif
   #endif
 
-  // Relative axis modes
-  uint8_t axis_relative;
+  #if DISABLED(POWER_LOSS_JOURNAL)
+    // Relative axis modes
+    uint8_t axis_relative;
+  #endif
 
   // SD Filename and position
   char sd_filename[MAXPATHNAMELENGTH];
-  volatile uint32_t sdpos;
+  #if DISABLED(POWER_LOSS_JOURNAL)
+    volatile uint32_t sdpos;
 
-  // Job elapsed time
-  millis_t print_job_elapsed;
+    // Job elapsed time
+    millis_t print_job_elapsed;
+  #endif
 
   // Misc. Marlin flags
   struct {
@@ -119,6 +150,28 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // The fields of job_recovery_info_t saved in each journal record
+  #define JOURNAL_DATA_START offsetof(job_recovery_info_t, current_position)
+  #define JOURNAL_DATA_SIZE  (offsetof(job_recovery_info_t, axis_relative) - JOURNAL_DATA_START)
+
+  typedef struct {
+    uint8_t valid_head;                 // The full record this one updates
+    uint8_t index;                      // Position in the journal
+    uint8_t data[JOURNAL_DATA_SIZE];
+    uint16_t crc;
+  } job_recovery_journal_t;
+
+  // The full record and the journal records after it
+  #define RECOVERY_FILE_SIZE (sizeof(job_recovery_info_t) + (POWER_LOSS_JOURNAL_SIZE) * sizeof(job_recovery_journal_t))
+
+#else
+
+  #define RECOVERY_FILE_SIZE sizeof(job_recovery_info_t)
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -193,6 +246,13 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint8_t journal_head, journal_count;
+      static uint16_t journal_crc;
+      static uint16_t base_crc();
+      static void load_journal();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
     #endif
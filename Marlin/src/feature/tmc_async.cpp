@@ -0,0 +1,198 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_ASYNC_STATUS)
+
+#include "tmc_async.h"
+
+#if HAS_TMC_CHAIN_SHADOW
+  #include <SPI.h>
+#endif
+
+// Registers kept in the shadow, in the order they are read
+static constexpr struct { uint8_t reg; uint32_t tmc_shadow_t::*field; } shadow_regs[] = {
+  { TMC_REG_DRV_STATUS, &tmc_shadow_t::DRV_STATUS }
+  #if ENABLED(TMC_DEBUG)
+    , { TMC_REG_PWM_SCALE, &tmc_shadow_t::PWM_SCALE }
+  #endif
+};
+
+#if HAS_TMC_HW_SERIAL
+
+  #define TMC_UART_SYNC    0x05
+  #define TMC_UART_MASTER  0xFF
+  #define TMC_UART_TIMEOUT 5    // (ms) Longest wait for a reply, as in TMCStepper
+
+  TMCAsyncSerial *TMCAsyncSerial::first, *TMCAsyncSerial::reading;
+  uint8_t TMCAsyncSerial::reg_index;
+  uint32_t TMCAsyncSerial::sync;
+  uint8_t TMCAsyncSerial::reply[8], TMCAsyncSerial::received;
+  millis_t TMCAsyncSerial::timeout;
+
+  // CRC8 of a UART datagram, as in the TMC220x datasheet
+  static uint8_t uart_crc(const uint8_t * const data, const uint8_t len) {
+    uint8_t crc = 0;
+    LOOP_L_N(i, len) {
+      uint8_t b = data[i];
+      LOOP_L_N(j, 8) {
+        crc = ((crc >> 7) ^ (b & 0x01)) ? (crc << 1) ^ 0x07 : crc << 1;
+        b >>= 1;
+      }
+    }
+    return crc;
+  }
+
+  // Drivers are constructed before setup(), so keep them in a simple list
+  TMCAsyncSerial::TMCAsyncSerial(Stream &port, const uint8_t slave) : shadow(), port(port), slave(slave), queued(0) {
+    next = first;
+    first = this;
+  }
+
+  int TMCAsyncSerial::available()                 { finish(); return port.available(); }
+  int TMCAsyncSerial::peek()                      { finish(); return port.peek(); }
+  int TMCAsyncSerial::read()                      { finish(); return port.read(); }
+  void TMCAsyncSerial::flush()                    { finish(); port.flush(); }
+  size_t TMCAsyncSerial::write(const uint8_t c)   { finish(); return port.write(c); }
+
+  // Send a read request for the next queued register
+  void TMCAsyncSerial::start() {
+    reg_index = COUNT(shadow_regs) - queued--;
+    uint8_t datagram[4] = { TMC_UART_SYNC, slave, shadow_regs[reg_index].reg, 0 };
+    datagram[3] = uart_crc(datagram, 3);
+    while (port.available() > 0) port.read();   // Drop anything left from an earlier exchange
+    port.write(datagram, sizeof(datagram));
+    sync = 0;
+    received = 0;
+    timeout = millis() + TMC_UART_TIMEOUT;
+    reading = this;
+  }
+
+  /**
+   * Take in the reply bytes received so far. The single-wire bus also echoes
+   * the request, so look for the start of the reply like TMCStepper does.
+   * Return 'true' once the read is over, with or without a good reply.
+   */
+  bool TMCAsyncSerial::collect() {
+    const uint8_t reg = shadow_regs[reg_index].reg;
+    while (received < sizeof(reply) && port.available() > 0) {
+      const uint8_t c = port.read();
+      if (received)
+        reply[received++] = c;
+      else {
+        sync = ((sync << 8) | c) & 0xFFFFFF;
+        if (sync == ((uint32_t(TMC_UART_SYNC) << 16) | (TMC_UART_MASTER << 8) | reg)) {
+          reply[0] = TMC_UART_SYNC; reply[1] = TMC_UART_MASTER; reply[2] = reg;
+          received = 3;
+        }
+      }
+    }
+
+    uint32_t &value = shadow.*shadow_regs[reg_index].field;
+    if (received == sizeof(reply))
+      value = uart_crc(reply, 7) == reply[7] ? (uint32_t(reply[3]) << 24) | (uint32_t(reply[4]) << 16) | (reply[5] << 8) | reply[6] : 0;
+    else if (ELAPSED(millis(), timeout))
+      value = 0;
+    else
+      return false;
+
+    reading = nullptr;
+    return true;
+  }
+
+  // Wait for the pending read, if any
+  void TMCAsyncSerial::finish() {
+    if (reading) while (!reading->collect()) { /* nada */ }
+  }
+
+  // Queue all registers of all drivers
+  void TMCAsyncSerial::refresh() {
+    for (TMCAsyncSerial *s = first; s; s = s->next) s->queued = COUNT(shadow_regs);
+  }
+
+  // Collect the pending read, or start the next one
+  void TMCAsyncSerial::update() {
+    if (reading && !reading->collect()) return;
+    for (TMCAsyncSerial *s = first; s; s = s->next)
+      if (s->queued) { s->start(); break; }
+  }
+
+#endif // HAS_TMC_HW_SERIAL
+
+#if HAS_TMC_CHAIN_SHADOW
+
+  #define TMC_CHAIN_MAX    16
+  #define TMC_SPI_SPEED    2000000  // As in TMCStepper
+
+  static tmc_shadow_t chain_shadow[TMC_CHAIN_MAX];
+  static uint8_t chain_length; // = 0
+  static pin_t chain_cs_pin;   // SanityCheck.h requires one CS pin for all chained drivers
+
+  // Get the shadow for a position in the chain, counting from the MCU's MOSI
+  tmc_shadow_t* tmc_chain_shadow(const uint8_t pos, const pin_t cs_pin) {
+    if (!WITHIN(pos, 1, TMC_CHAIN_MAX)) return nullptr;
+    // Only one chain is read in the background. Any other driver is read directly.
+    if (!chain_length)
+      chain_cs_pin = cs_pin;
+    else if (cs_pin != chain_cs_pin)
+      return nullptr;
+    NOLESS(chain_length, pos);
+    return &chain_shadow[pos - 1];
+  }
+
+  /**
+   * Read the same register from every chained driver. The first pass sends a
+   * read request to each driver. In the second pass each driver shifts out its
+   * reply, starting with the one furthest from the MCU.
+   */
+  static void chain_read(const uint8_t reg, uint32_t tmc_shadow_t::*field) {
+    SPI.beginTransaction(SPISettings(TMC_SPI_SPEED, MSBFIRST, SPI_MODE3));
+    LOOP_L_N(pass, 2) {
+      extDigitalWrite(chain_cs_pin, LOW);
+      for (uint8_t pos = chain_length; pos; pos--) {
+        SPI.transfer(reg);        // Reply: SPI status
+        uint32_t value = 0;
+        LOOP_L_N(i, 4) value = (value << 8) | SPI.transfer(0);
+        if (pass) chain_shadow[pos - 1].*field = value;
+      }
+      extDigitalWrite(chain_cs_pin, HIGH);
+    }
+    SPI.endTransaction();
+  }
+
+  void tmc_chain_refresh() {
+    for (const auto &r : shadow_regs) chain_read(r.reg, r.field);
+  }
+
+#endif // HAS_TMC_CHAIN_SHADOW
+
+void tmc_status_refresh() {
+  TERN_(HAS_TMC_HW_SERIAL, TMCAsyncSerial::refresh());
+  TERN_(HAS_TMC_CHAIN_SHADOW, tmc_chain_refresh());
+}
+
+void tmc_status_update() {
+  TERN_(HAS_TMC_HW_SERIAL, TMCAsyncSerial::update());
+}
+
+#endif // TMC_ASYNC_STATUS
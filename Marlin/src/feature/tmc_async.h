@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * tmc_async.h - Read TMC driver status without stalling the main loop
+ *
+ * Drivers that support it keep a shadow copy of their status registers,
+ * refreshed in the background once per monitor poll. The monitor uses the
+ * shadow, which is one poll interval old, instead of reading each driver.
+ *
+ * UART drivers on a hardware serial port are given a TMCAsyncSerial as
+ * their Stream. A status read sends the request and picks up the reply on a
+ * later idle(), one read at a time. Any access by the TMCStepper library
+ * waits for the pending read first, so nothing is sent over a reply on the
+ * single-wire bus.
+ *
+ * Chained SPI drivers are read together, with one pass down the chain to
+ * send the requests and one to shift all the replies out.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TMC_REG_DRV_STATUS 0x6F
+#define TMC_REG_PWM_SCALE  0x71
+
+typedef struct {
+  uint32_t DRV_STATUS;    // 0 if the last read failed
+  #if ENABLED(TMC_DEBUG)
+    uint32_t PWM_SCALE;
+  #endif
+} tmc_shadow_t;
+
+#if HAS_TMC_HW_SERIAL
+
+  class TMCAsyncSerial : public Stream {
+  public:
+    tmc_shadow_t shadow;
+
+    TMCAsyncSerial(Stream &port, const uint8_t slave);
+
+    // Stream for the TMCStepper library
+    int available();
+    int peek();
+    int read();
+    void flush();
+    size_t write(const uint8_t c);
+    using Print::write;
+
+    static void refresh();
+    static void update();
+    static void finish();
+
+  private:
+    Stream &port;
+    const uint8_t slave;
+    uint8_t queued;                 // Registers still to read this round
+    TMCAsyncSerial *next;
+
+    static TMCAsyncSerial *first, *reading;
+    static uint8_t reg_index;       // Register being read
+    static uint32_t sync;           // Last three bytes received, to find the reply
+    static uint8_t reply[8], received;
+    static millis_t timeout;
+
+    void start();
+    bool collect();
+  };
+
+#endif
+
+#if HAS_TMC_SPI && DISABLED(TMC_USE_SW_SPI) && !HAS_DRIVER(TMC2660)
+  #define TMC_IN_CHAIN(A) (AXIS_HAS_SPI(A) && A##_CHAIN_POS > 0)
+  #if TMC_IN_CHAIN(X) || TMC_IN_CHAIN(Y) || TMC_IN_CHAIN(Z) || TMC_IN_CHAIN(X2) || TMC_IN_CHAIN(Y2) || TMC_IN_CHAIN(Z2) || TMC_IN_CHAIN(Z3) || TMC_IN_CHAIN(Z4) \
+    || TMC_IN_CHAIN(E0) || TMC_IN_CHAIN(E1) || TMC_IN_CHAIN(E2) || TMC_IN_CHAIN(E3) || TMC_IN_CHAIN(E4) || TMC_IN_CHAIN(E5) || TMC_IN_CHAIN(E6) || TMC_IN_CHAIN(E7)
+    #define HAS_TMC_CHAIN_SHADOW 1
+    tmc_shadow_t* tmc_chain_shadow(const uint8_t pos, const pin_t cs_pin);
+    void tmc_chain_refresh();
+  #endif
+#endif
+
+// Start a new round of background reads
+void tmc_status_refresh();
+
+// Collect replies and start pending reads. Call often.
+void tmc_status_update();
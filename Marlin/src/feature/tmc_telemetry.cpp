@@ -0,0 +1,236 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_TELEMETRY)
+
+#include "tmc_telemetry.h"
+#include "tmc_util.h"
+#include "../module/stepper/indirection.h"
+#include "../module/stepper.h"
+#include "../module/planner.h"
+#include "../libs/crc16.h"
+
+TMCTelemetry tmc_telemetry;
+
+uint16_t TMCTelemetry::interval; // = 0
+uint16_t TMCTelemetry::drivers, TMCTelemetry::pending;
+millis_t TMCTelemetry::next_ms;
+#if HAS_MULTI_SERIAL
+  int8_t TMCTelemetry::port;
+#endif
+
+tmc_sample_t TMCTelemetry::buffer[TMC_TELEMETRY_BUFFER];
+uint8_t TMCTelemetry::index_r, TMCTelemetry::length, TMCTelemetry::lost;
+
+//
+// Read the status of one driver. One register read on most drivers.
+//
+#if HAS_TMCX1X0
+  static void read_driver(TMC2130Stepper &st, tmc_sample_t &s) {
+    s.drv_status = st.DRV_STATUS();
+    s.sg_result = s.drv_status & 0x3FF;         // 0:9
+    s.cs_actual = (s.drv_status >> 16) & 0x1F;  // 16:20
+  }
+#endif
+
+#if HAS_TMC220x
+  static void read_driver(TMC2208Stepper &st, tmc_sample_t &s) {
+    s.drv_status = st.DRV_STATUS();
+    s.sg_result = 0;
+    s.cs_actual = (s.drv_status >> 16) & 0x1F;  // 16:20
+  }
+  #if HAS_DRIVER(TMC2209)
+    static void read_driver(TMC2209Stepper &st, tmc_sample_t &s) {
+      read_driver(static_cast<TMC2208Stepper &>(st), s);
+      s.sg_result = st.SG_RESULT();
+    }
+  #endif
+#endif
+
+#if HAS_DRIVER(TMC2660)
+  static void read_driver(TMC2660Stepper &st, tmc_sample_t &s) {
+    s.drv_status = st.DRVSTATUS();
+    s.sg_result = (s.drv_status >> 10) & 0x3FF; // 10:19
+    s.cs_actual = 0;
+  }
+#endif
+
+/**
+ * Start sampling the given drivers every 'ms' milliseconds.
+ * Samples are sent to the serial port of the current command.
+ */
+void TMCTelemetry::start(const uint16_t ms, const uint16_t in_drivers) {
+  interval = ms;
+  drivers = in_drivers;
+  index_r = length = lost = 0;
+  pending = 0;
+  next_ms = millis();
+  TERN_(HAS_MULTI_SERIAL, port = serial_port_index);
+}
+
+void TMCTelemetry::stop() {
+  interval = 0;
+  length = 0;
+  pending = 0;
+}
+
+void TMCTelemetry::push(tmc_sample_t &s) {
+  s.lost = lost;
+  lost = 0;
+  buffer[(index_r + length) % (TMC_TELEMETRY_BUFFER)] = s;
+  length++;
+}
+
+/**
+ * Read the next pending driver. With the buffer full the sample is
+ * only counted as lost, saving a read that would be thrown away.
+ */
+void TMCTelemetry::sample() {
+  tmc_sample_t s;
+  s.time = millis();
+  s.block = planner.block_buffer_tail;
+
+  #define TM_SAMPLE(ST, A) do{ \
+    if (TEST(pending, TMC_TM_##ST)) { \
+      CBI(pending, TMC_TM_##ST); \
+      if (length < TMC_TELEMETRY_BUFFER) { \
+        read_driver(stepper##ST, s); \
+        s.driver = TMC_TM_##ST; \
+        s.position = stepper.position(A); \
+        push(s); \
+      } \
+      else if (lost < 255) \
+        lost++; \
+      return; \
+    } \
+  }while(0)
+
+  #if AXIS_IS_TMC(X)
+    TM_SAMPLE(X, X_AXIS);
+  #endif
+  #if AXIS_IS_TMC(X2)
+    TM_SAMPLE(X2, X_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Y)
+    TM_SAMPLE(Y, Y_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Y2)
+    TM_SAMPLE(Y2, Y_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Z)
+    TM_SAMPLE(Z, Z_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Z2)
+    TM_SAMPLE(Z2, Z_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Z3)
+    TM_SAMPLE(Z3, Z_AXIS);
+  #endif
+  #if AXIS_IS_TMC(Z4)
+    TM_SAMPLE(Z4, Z_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E0)
+    TM_SAMPLE(E0, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E1)
+    TM_SAMPLE(E1, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E2)
+    TM_SAMPLE(E2, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E3)
+    TM_SAMPLE(E3, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E4)
+    TM_SAMPLE(E4, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E5)
+    TM_SAMPLE(E5, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E6)
+    TM_SAMPLE(E6, E_AXIS);
+  #endif
+  #if AXIS_IS_TMC(E7)
+    TM_SAMPLE(E7, E_AXIS);
+  #endif
+
+  pending = 0;  // Only drivers that aren't TMC were left
+}
+
+/**
+ * Free space in a port's transmit buffer. Ports that can't tell
+ * are assumed to have room, and sending may wait on them.
+ */
+template<typename T>
+static auto tx_free(T &port, int) -> decltype(size_t(port.get_tx_buffer_free())) { return port.get_tx_buffer_free(); }
+template<typename T>
+static auto tx_free(T &port, long) -> decltype(size_t(port.availableForWrite())) { return port.availableForWrite(); }
+template<typename T>
+static size_t tx_free(T&, ...) { return SIZE_MAX; }
+
+static bool tx_room(const int8_t port) {
+  constexpr size_t frame_size = 2 + sizeof(tmc_sample_t) + 2;
+  #if HAS_MULTI_SERIAL
+    if ((port == 1 || port == SERIAL_BOTH) && tx_free(MYSERIAL1, 0) < frame_size) return false;
+    if (port == 1) return true;
+  #else
+    UNUSED(port);
+  #endif
+  return tx_free(MYSERIAL0, 0) >= frame_size;
+}
+
+void TMCTelemetry::send(const tmc_sample_t &s) {
+  PORT_REDIRECT(port);
+  uint16_t crc = 0;
+  crc16(&crc, &s, sizeof(s));
+  SERIAL_CHAR(TMC_TELEMETRY_SYNC1, TMC_TELEMETRY_SYNC2);
+  const uint8_t *b = (const uint8_t*)&s;
+  LOOP_L_N(i, sizeof(s)) SERIAL_CHAR(b[i]);
+  SERIAL_CHAR(crc & 0xFF, crc >> 8);
+}
+
+/**
+ * Called from idle(). Send one queued sample if the port has room,
+ * then read the next driver for this sample time. When it's time to
+ * sample again and anything is moving, queue up all the drivers.
+ */
+void TMCTelemetry::update() {
+  if (!interval) return;
+
+  if (length && tx_room(TERN(HAS_MULTI_SERIAL, port, 0))) {
+    send(buffer[index_r]);
+    index_r = (index_r + 1) % (TMC_TELEMETRY_BUFFER);
+    length--;
+  }
+
+  const millis_t ms = millis();
+  if (!pending && ELAPSED(ms, next_ms)) {
+    next_ms = ms + interval;
+    if (planner.has_blocks_queued()) pending = drivers;
+  }
+
+  if (pending) sample();
+}
+
+#endif // TMC_TELEMETRY
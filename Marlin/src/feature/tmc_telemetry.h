@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * tmc_telemetry.h - Stream TMC driver load data while moving
+ *
+ * At each sample time, while the planner has moves, the selected drivers
+ * are read into a ring buffer, one driver per idle() so a slow UART read
+ * only holds up one loop. Queued samples are sent one per idle(), and only
+ * when the port has room for the whole frame, so a slow host link drops
+ * samples instead of stalling the machine. Each sample counts the samples
+ * dropped just before it.
+ *
+ * Frame: 0xA5 0x5A, a tmc_sample_t (little-endian), then the CRC16 of the
+ * sample (the EEPROM CRC, starting at 0), low byte first.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TMC_TELEMETRY_SYNC1 0xA5
+#define TMC_TELEMETRY_SYNC2 0x5A
+
+// Driver numbers, in M122 order
+enum TMCTelemetryDriver : uint8_t {
+  TMC_TM_X, TMC_TM_X2, TMC_TM_Y, TMC_TM_Y2,
+  TMC_TM_Z, TMC_TM_Z2, TMC_TM_Z3, TMC_TM_Z4,
+  TMC_TM_E0, TMC_TM_E1, TMC_TM_E2, TMC_TM_E3,
+  TMC_TM_E4, TMC_TM_E5, TMC_TM_E6, TMC_TM_E7
+};
+
+typedef struct {
+  uint16_t time;          // Low 16 bits of millis()
+  uint8_t driver;         // TMCTelemetryDriver
+  uint8_t block;          // Index of the planner block being run
+  int32_t position;       // Step position of the driver's axis
+  uint32_t drv_status;    // Raw DRV_STATUS
+  uint16_t sg_result;     // StallGuard load value. 0 if not supported.
+  uint8_t cs_actual;      // Actual current scale, 0-31. 0 if not supported.
+  uint8_t lost;           // Samples dropped before this one (up to 255)
+} tmc_sample_t;
+
+class TMCTelemetry {
+public:
+  static void start(const uint16_t ms, const uint16_t drivers);
+  static void stop();
+  static void update();
+  static inline bool active() { return interval; }
+  static inline uint16_t get_interval() { return interval; }
+
+private:
+  static uint16_t interval;       // Milliseconds between samples. 0 when off.
+  static uint16_t drivers;        // One bit per TMCTelemetryDriver
+  static uint16_t pending;        // Drivers still to read for this sample time
+  static millis_t next_ms;
+  #if HAS_MULTI_SERIAL
+    static int8_t port;
+  #endif
+
+  static tmc_sample_t buffer[TMC_TELEMETRY_BUFFER];
+  static uint8_t index_r, length, lost;
+
+  static void sample();
+  static void push(tmc_sample_t &s);
+  static void send(const tmc_sample_t &s);
+};
+
+extern TMCTelemetry tmc_telemetry;
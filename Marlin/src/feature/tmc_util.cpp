@@ -81,10 +81,10 @@
   #if HAS_TMCX1X0
 
     #if ENABLED(TMC_DEBUG)
-      static uint32_t get_pwm_scale(TMC2130Stepper &st) { return st.PWM_SCALE(); }
+      static uint32_t get_pwm_scale(TMC2130Stepper &, const uint32_t pwm_scale) { return pwm_scale; }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2130Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2130Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 25, OTPW_bp = 26;
       constexpr uint32_t S2G_bm = 0x18000000;
       #if ENABLED(TMC_DEBUG)
@@ -95,7 +95,7 @@
         constexpr uint8_t STST_bp = 31;
       #endif
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       #ifdef __AVR__
 
         // 8-bit optimization saves up to 70 bytes of PROGMEM per axis
@@ -142,14 +142,14 @@
   #if HAS_TMC220x
 
     #if ENABLED(TMC_DEBUG)
-      static uint32_t get_pwm_scale(TMC2208Stepper &st) { return st.pwm_scale_sum(); }
+      static uint32_t get_pwm_scale(TMC2208Stepper &, const uint32_t pwm_scale) { return pwm_scale & 0xFF; } // PWM_SCALE_SUM
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2208Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2208Stepper &, const uint32_t ds) {
       constexpr uint8_t OTPW_bp = 0, OT_bp = 1;
       constexpr uint8_t S2G_bm = 0b11110; // 2..5
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       data.is_otpw = TEST(ds, OTPW_bp);
       data.is_ot = TEST(ds, OT_bp);
       data.is_s2g = !!(ds & S2G_bm);
@@ -179,14 +179,14 @@
   #if HAS_DRIVER(TMC2660)
 
     #if ENABLED(TMC_DEBUG)
-      static uint32_t get_pwm_scale(TMC2660Stepper) { return 0; }
+      static uint32_t get_pwm_scale(TMC2660Stepper &, const uint32_t) { return 0; }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2660Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2660Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 1, OTPW_bp = 2;
       constexpr uint8_t S2G_bm = 0b11000;
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRVSTATUS();
+      data.drv_status = ds;
       uint8_t spart = ds & 0xFF;
       data.is_otpw = TEST(spart, OTPW_bp);
       data.is_ot = TEST(spart, OT_bp);
@@ -205,6 +205,32 @@
 
   #endif // TMC2660
 
+  /**
+   * Read a status register, or use the copy read in the background
+   */
+  #if ENABLED(TMC_ASYNC_STATUS)
+    #define TMC_STATUS_REG(ST, REG) ((ST).shadow ? (ST).shadow->REG : (ST).REG())
+  #else
+    #define TMC_STATUS_REG(ST, REG) (ST).REG()
+  #endif
+
+  template<typename TMC>
+  static uint32_t read_drv_status(TMC &st) { return TMC_STATUS_REG(st, DRV_STATUS); }
+
+  #if ENABLED(TMC_DEBUG)
+    template<typename TMC>
+    static uint32_t read_pwm_scale(TMC &st) { return TMC_STATUS_REG(st, PWM_SCALE); }
+  #endif
+
+  #if HAS_DRIVER(TMC2660)
+    template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+    static uint32_t read_drv_status(TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st) { return st.DRVSTATUS(); }
+    #if ENABLED(TMC_DEBUG)
+      template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+      static uint32_t read_pwm_scale(TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &) { return 0; }
+    #endif
+  #endif
+
   #if ENABLED(STOP_ON_ERROR)
     void report_driver_error(const TMC_driver_data &data) {
       SERIAL_ECHOPGM(" driver error detected: 0x");
@@ -231,7 +257,7 @@
 
   template<typename TMC>
   void report_polled_driver_data(TMC &st, const TMC_driver_data &data) {
-    const uint32_t pwm_scale = get_pwm_scale(st);
+    const uint32_t pwm_scale = get_pwm_scale(st, read_pwm_scale(st));
     st.printLabel();
     SERIAL_CHAR(':'); SERIAL_PRINT(pwm_scale, DEC);
     #if ENABLED(TMC_DEBUG)
@@ -285,7 +311,7 @@
 
   template<typename TMC>
   bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
-    TMC_driver_data data = get_driver_data(st);
+    TMC_driver_data data = get_driver_data(st, read_drv_status(st));
     if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
 
     bool should_step_down = false;
@@ -327,6 +353,8 @@
   }
 
   void monitor_tmc_drivers() {
+    TERN_(TMC_ASYNC_STATUS, tmc_status_update());
+
     const millis_t ms = millis();
 
     // Poll TMC drivers at the configured interval
@@ -443,6 +471,9 @@
       #endif
 
       if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+
+      // Read status in the background for the next poll
+      TERN_(TMC_ASYNC_STATUS, tmc_status_refresh());
     }
   }
 
@@ -1139,7 +1170,11 @@
 #endif // USE_SENSORLESS
 
 #if HAS_TMC_SPI
-  #define SET_CS_PIN(st) OUT_WRITE(st##_CS_PIN, HIGH)
+  #if HAS_TMC_CHAIN_SHADOW
+    #define SET_CS_PIN(st) do{ OUT_WRITE(st##_CS_PIN, HIGH); if (st##_CHAIN_POS > 0) stepper##st.shadow = tmc_chain_shadow(st##_CHAIN_POS, st##_CS_PIN); }while(0)
+  #else
+    #define SET_CS_PIN(st) OUT_WRITE(st##_CS_PIN, HIGH)
+  #endif
   void tmc_init_cs_pins() {
     #if AXIS_HAS_SPI(X)
       SET_CS_PIN(X);
@@ -29,6 +29,10 @@
 #include <TMCStepper.h>
 #include "../module/planner.h"
 
+#if ENABLED(TMC_ASYNC_STATUS)
+  #include "tmc_async.h"
+#endif
+
 #define CHOPPER_DEFAULT_12V  { 3, -1, 1 }
 #define CHOPPER_DEFAULT_19V  { 4,  1, 1 }
 #define CHOPPER_DEFAULT_24V  { 4,  2, 1 }
@@ -62,6 +66,10 @@ class TMCStorage {
       inline void clear_otpw() { flag_otpw = 0; }
     #endif
 
+    #if ENABLED(TMC_ASYNC_STATUS)
+      tmc_shadow_t *shadow = nullptr;   // Status read in the background, if supported
+    #endif
+
     inline uint16_t getMilliamps() { return val_mA; }
 
     inline void printLabel() {
@@ -282,6 +282,9 @@ void GcodeSuite::G28() {
 
   TERN_(IMPROVE_HOMING_RELIABILITY, slow_homing_t slow_homing = begin_slow_homing());
 
+  // Home without Input Shaping, so the motors stop where the endstops trigger
+  TERN_(HAS_SHAPING, stepper.suspend_shaping(true));
+
   // Always home with tool 0 active
   #if HAS_MULTI_HOTEND
     #if DISABLED(DELTA) || ENABLED(DELTA_HOME_TO_SAFE_ZONE)
@@ -459,6 +462,11 @@ void GcodeSuite::G28() {
     #endif
   #endif
 
+  #if HAS_SHAPING
+    planner.synchronize();
+    stepper.suspend_shaping(false);
+  #endif
+
   ui.refresh();
 
   TERN_(DWIN_CREALITY_LCD, DWIN_CompletedHoming());
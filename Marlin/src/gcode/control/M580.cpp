@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../feature/laser_raster.h"
+
+/**
+ * M580: Add pixels to the next raster line
+ *
+ *   M580 <base64> - Append the decoded pixels (0-255 each) for the next G7
+ *   M580          - Discard the pixels not yet engraved
+ */
+void GcodeSuite::M580() {
+  const char * const data = parser.string_arg;
+  if (!data || !*data)
+    laser_raster.discard();
+  else if (!laser_raster.add_base64(data))
+    SERIAL_ECHOLNPAIR("?Raster line is limited to ", LASER_RASTER_PIXELS, " pixels.");
+}
+
+#endif // LASER_RASTER
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../../gcode.h"
+#include "../../../module/planner.h"
+#include "../../../module/stepper.h"
+
+void M593_report(const AxisEnum axis) {
+  const shaping_params_t &p = stepper.get_shaping(axis);
+  SERIAL_ECHOLNPAIR("M593 ", axis_codes[axis], " F", p.frequency, " D", p.zeta, " T", int(p.type));
+}
+
+/**
+ * M593: Get or Set Input Shaping parameters
+ *  X         Set the X axis
+ *  Y         Set the Y axis
+ *  F<freq>   Resonant frequency (Hz). 0 turns shaping off.
+ *  D<zeta>   Damping ratio (0-0.99)
+ *  T<type>   Shaper type: 0 = ZV, 1 = ZVD, 2 = MZV
+ *
+ * With no axis all shaped axes are set.
+ * On COREXY/COREYX both axes are always set together.
+ * With no F, D, or T report the settings.
+ */
+void GcodeSuite::M593() {
+  const bool seen_x = TERN0(INPUT_SHAPING_X, parser.seen('X')),
+             seen_y = TERN0(INPUT_SHAPING_Y, parser.seen('Y')),
+             all = !seen_x && !seen_y;
+
+  if (!parser.seen("FDT")) {
+    TERN_(INPUT_SHAPING_X, if (all || seen_x) M593_report(X_AXIS));
+    TERN_(INPUT_SHAPING_Y, if (all || seen_y) M593_report(Y_AXIS));
+    return;
+  }
+
+  // Echoes in progress would be lost
+  planner.synchronize();
+
+  auto set_axis = [](const AxisEnum axis) {
+    shaping_params_t p = stepper.get_shaping(axis);
+    if (parser.seenval('F')) p.frequency = parser.value_float();
+    if (parser.seenval('D')) p.zeta = parser.value_float();
+    if (parser.seenval('T')) p.type = ShapingType(parser.value_byte());
+    if (!stepper.set_shaping(axis, p)) {
+      SERIAL_CHAR('?', axis_codes[axis]);
+      SERIAL_ECHOLNPAIR(" shaper out of range (F0 or F", SHAPING_MIN_FREQ, "+, D0-0.99, T0-2).");
+    }
+  };
+
+  TERN_(INPUT_SHAPING_X, if (all || seen_x) set_axis(X_AXIS));
+  TERN_(INPUT_SHAPING_Y, if (all || seen_y) set_axis(Y_AXIS));
+}
+
+#endif // HAS_SHAPING
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_TELEMETRY)
+
+#include "../../gcode.h"
+#include "../../../feature/tmc_telemetry.h"
+
+/**
+ * M919: Stream TMC driver load data
+ *
+ *  S<ms>   Sample interval in milliseconds. S0 to stop.
+ *  X Y Z E Drivers to sample. All drivers by default.
+ *
+ * Samples are taken while moving and sent as binary frames.
+ * See tmc_telemetry.h for the format.
+ * With no parameters, report the current state.
+ */
+void GcodeSuite::M919() {
+  if (parser.seen('S')) {
+    const uint16_t ms = parser.value_ushort();
+    if (!ms) return tmc_telemetry.stop();
+
+    constexpr uint16_t axis_drivers[] = {
+      _BV(TMC_TM_X) | _BV(TMC_TM_X2),
+      _BV(TMC_TM_Y) | _BV(TMC_TM_Y2),
+      _BV(TMC_TM_Z) | _BV(TMC_TM_Z2) | _BV(TMC_TM_Z3) | _BV(TMC_TM_Z4),
+      0xFF00 // E0-E7
+    };
+    uint16_t drivers = 0;
+    LOOP_XYZE(i) if (parser.seen(axis_codes[i])) drivers |= axis_drivers[i];
+    tmc_telemetry.start(ms, drivers ?: 0xFFFF);
+    return;
+  }
+
+  SERIAL_ECHOPGM("TMC telemetry ");
+  if (tmc_telemetry.active())
+    SERIAL_ECHOLNPAIR("every ", tmc_telemetry.get_interval(), "ms");
+  else
+    SERIAL_ECHOLNPGM("off");
+}
+
+#endif // TMC_TELEMETRY
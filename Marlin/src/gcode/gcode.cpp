@@ -61,6 +61,8 @@ GcodeSuite gcode;
   #include "../feature/password/password.h"
 #endif
 
+#include "../feature/loop_profile.h"
+
 #include "../MarlinCore.h" // for idle()
 
 // Inactivity shutdown
@@ -244,6 +246,7 @@ void GcodeSuite::dwell(millis_t time) {
  */
 void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
   KEEPALIVE_STATE(IN_HANDLER);
+  PROFILE_GCODE();
 
  /**
   * Block all Gcodes except M511 Unlock Printer, if printer is locked
@@ -277,6 +280,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 6: G6(); break;                                      // G6: Direct Stepper Move
       #endif
 
+      #if ENABLED(LASER_RASTER)
+        case 7: G7(); break;                                      // G7: Raster Engraving Move
+      #endif
+
       #if ENABLED(FWRETRACT)
         case 10: G10(); break;                                    // G10: Retract / Swap Retract
         case 11: G11(); break;                                    // G11: Recover / Swap Recover
@@ -776,6 +783,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(LASER_RASTER)
+        case 580: M580(); break;                                  // M580: Add raster pixels
+      #endif
+
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Set Input Shaping parameters
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -856,6 +871,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         #if USE_SENSORLESS
           case 914: M914(); break;                                // M914: Set StallGuard sensitivity.
         #endif
+        #if ENABLED(TMC_TELEMETRY)
+          case 919: M919(); break;                                // M919: Stream TMC driver load data
+        #endif
       #endif
 
       #if HAS_L64XX
@@ -900,6 +918,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 422: M422(); break;                                  // M422: Set Z Stepper automatic alignment position using probe
       #endif
 
+      #if ENABLED(LOOP_PROFILING)
+        case 990: M990(); break;                                  // M990: Report or reset main loop timing
+      #endif
+
       #if ALL(HAS_SPI_FLASH, SDSUPPORT, MARLIN_DEV_MODE)
         case 993: M993(); break;                                  // M993: Backup SPI Flash to SD
         case 994: M994(); break;                                  // M994: Load a Backup from SD to SPI Flash
@@ -953,7 +975,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  char * const current_command = queue.command(queue.index_r);
 
   PORT_REDIRECT(queue.port[queue.index_r]);
 
@@ -961,12 +983,25 @@ void GcodeSuite::process_next_command() {
     recovery.queue_index_r = queue.index_r;
   #endif
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    // Pre-parsed commands from the binary stream
+    if (*current_command == BINARY_COMMAND_MARK) {
+      parser.parse_binary(current_command);
+      process_parsed_command();
+      return;
+    }
+  #endif
+
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
     SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
-      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      #if ENABLED(PACKED_COMMAND_QUEUE)
+        M100_dump_routine(PSTR("   Command Queue:"), &queue.command_pool[0], &queue.command_pool[COMMAND_QUEUE_BYTES - 1]);
+      #else
+        M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      #endif
     #endif
   }
 
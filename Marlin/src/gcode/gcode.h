@@ -48,6 +48,7 @@
  * G3   - CCW ARC
  * G4   - Dwell S<seconds> or P<milliseconds>
  * G5   - Cubic B-spline with XYZE destination and IJPQ offsets
+ * G7   - Engrave the raster line sent with M580 along an XY move (Requires LASER_RASTER)
  * G10  - Retract filament according to settings of M207 (Requires FWRETRACT)
  * G11  - Retract recover filament according to settings of M208 (Requires FWRETRACT)
  * G12  - Clean tool (Requires NOZZLE_CLEAN_FEATURE)
@@ -90,7 +91,7 @@
  * M16  - Expected printer check. (Requires EXPECTED_PRINTER_CHECK)
  * M17  - Enable/Power all stepper motors
  * M18  - Disable all stepper motors; same as M84
- * M20  - List SD card. (Requires SDSUPPORT)
+ * M20  - List SD card. (Requires SDSUPPORT) With SD_PAGED_LISTING: "M20 S<index> C<count> [B] [D<folder>] [U] [R]" lists a page of the working folder.
  * M21  - Init SD card. (Requires SDSUPPORT)
  * M22  - Release SD card. (Requires SDSUPPORT)
  * M23  - Select SD file: "M23 /path/file.gco". (Requires SDSUPPORT)
@@ -234,6 +235,8 @@
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M580 - Add base64-encoded pixels to the next raster line: "M580 <base64>". (Requires LASER_RASTER)
+ * M593 - Get or set Input Shaping parameters: "M593 [X] [Y] F<Hz> D<zeta> T<type>". (Requires INPUT_SHAPING_X or INPUT_SHAPING_Y)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -271,6 +274,7 @@
  * M916 - L6470 tuning: Increase KVAL_HOLD until thermal warning. (Requires at least one _DRIVER_TYPE L6470)
  * M917 - L6470 tuning: Find minimum current thresholds. (Requires at least one _DRIVER_TYPE L6470)
  * M918 - L6470 tuning: Increase speed until max or error. (Requires at least one _DRIVER_TYPE L6470)
+ * M919 - Stream TMC driver load data. (Requires TMC_TELEMETRY)
  * M951 - Set Magnetic Parking Extruder parameters. (Requires MAGNETIC_PARKING_EXTRUDER)
  * M7219 - Control Max7219 Matrix LEDs. (Requires MAX7219_GCODE)
  *
@@ -283,6 +287,7 @@
  * ************ Custom codes - This can change to suit future G-code regulations
  * G425 - Calibrate using a conductive object. (Requires CALIBRATION_GCODE)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M990 - Report main loop and G-code timing. "M990 R" to reset. (Requires LOOP_PROFILING)
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
@@ -423,6 +428,7 @@ private:
   TERN_(BEZIER_CURVE_SUPPORT, static void G5());
 
   TERN_(DIRECT_STEPPING, static void G6());
+  TERN_(LASER_RASTER, static void G7());
 
   #if ENABLED(FWRETRACT)
     static void G10();
@@ -789,6 +795,10 @@ private:
 
   TERN_(BAUD_RATE_GCODE, static void M575());
 
+  TERN_(LASER_RASTER, static void M580());
+
+  TERN_(HAS_SHAPING, static void M593());
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -847,6 +857,7 @@ private:
     #endif
     TERN_(HYBRID_THRESHOLD, static void M913());
     TERN_(USE_SENSORLESS, static void M914());
+    TERN_(TMC_TELEMETRY, static void M919());
   #endif
 
   #if HAS_L64XX
@@ -872,6 +883,8 @@ private:
 
   TERN_(MAGNETIC_PARKING_EXTRUDER, static void M951());
 
+  TERN_(LOOP_PROFILING, static void M990());
+
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
 
   #if BOTH(HAS_SPI_FLASH, SDSUPPORT)
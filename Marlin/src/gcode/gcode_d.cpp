@@ -27,9 +27,68 @@
   #include "../module/settings.h"
   #include "../module/temperature.h"
   #include "../libs/hex_print.h"
+  #include "../libs/crc16.h"
   #include "../HAL/shared/eeprom_if.h"
   #include "../HAL/shared/Delay.h"
 
+  #if ANY(STEPPER_ISR_PROFILING, FIXED_POINT_TRAPEZOIDS, LASER_POWER_INLINE_TRAPEZOID)
+    #include "../module/planner.h"
+  #endif
+
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    #include "../module/motion.h"
+    #include "../module/stepper.h"
+    #include "../feature/spindle_laser.h"
+  #endif
+
+  #if ENABLED(STEPPER_ISR_PROFILING)
+
+    #include "../module/motion.h"
+    #include "../module/stepper.h"
+
+    /**
+     * Queue one of the canned D6 move sequences, returning to the start point.
+     * Moves stay within 10mm of the current position.
+     */
+    static void profile_sequence(const uint8_t seq, const uint16_t count, const feedRate_t fr_mm_s) {
+      const xyze_pos_t start = current_position;
+      xyze_pos_t p = start;
+      for (uint16_t i = 0; i < count; i++) {
+        switch (seq) {
+          default:
+          case 0:   // 0.1mm zig-zag, as in small text and detailed perimeters
+            p.x = start.x + 0.1f * (i & 1);
+            p.y = start.y + 0.1f * ((i >> 1) & 1);
+            break;
+          case 1: { // 10mm circle split into 'count' chords
+            const float a = RADIANS(360) * (i + 1) / count;
+            p.x = start.x + 5 * (cos(a) - 1);
+            p.y = start.y + 5 * sin(a);
+          } break;
+          case 2:   // 20mm square, segmented by the kinematics
+            destination = start;
+            destination.x += (((i + 1) & 3) >> 1) ? 10 : -10;
+            destination.y += (((i + 2) & 3) >> 1) ? 10 : -10;
+            if (!((i + 1) & 3)) destination = start;
+            feedrate_mm_s = fr_mm_s;
+            prepare_line_to_destination();
+            continue;
+          case 3:   // 0.2mm extruding segments, as in infill with LIN_ADVANCE
+            p.x = start.x + 0.2f * (i & 1);
+            p.y = start.y + 0.2f * ((i >> 1) & 1);
+            p.e += 0.01f;
+            break;
+          case 4:   // 10mm line back and forth in 0.25mm segments, accelerating through the whole buffer
+            p.x = start.x + 0.25f * ((i % 80) < 40 ? (i % 40) + 1 : 39 - (i % 40));
+            break;
+        }
+        planner.buffer_line(p, fr_mm_s, active_extruder);
+      }
+      if (seq != 2) current_position = p;
+    }
+
+  #endif
+
   /**
    * Dn: G-code for development and testing
    *
@@ -172,6 +231,162 @@
         }
       } break;
 
+      #if ENABLED(STEPPER_ISR_PROFILING)
+        case 6: { // D6 Stepper ISR benchmark: S<sequence> C<count> F<feedrate>
+          const uint8_t seq = parser.byteval('S');
+          const uint16_t count = parser.ushortval('C', 1000);
+          const feedRate_t fr_mm_s = parser.seenval('F') ? parser.value_feedrate() : 100;
+          const feedRate_t old_feedrate = feedrate_mm_s;
+
+          planner.synchronize();
+          stepper.reset_isr_profile();
+          planner.replan_profile = {};
+          #if ENABLED(PREVENT_COLD_EXTRUSION)
+            const bool old_cold = thermalManager.allow_cold_extrude;
+            thermalManager.allow_cold_extrude = true;
+          #endif
+          const millis_t start_ms = millis();
+
+          profile_sequence(seq, count, fr_mm_s);
+          planner.synchronize();
+
+          const millis_t elapsed = millis() - start_ms;
+          TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = old_cold);
+          feedrate_mm_s = old_feedrate;
+
+          SERIAL_ECHOLNPAIR("D6 S", int(seq), " C", count, " time:", elapsed, "ms");
+          stepper.report_isr_profile();
+          planner.report_replan_profile();
+        } break;
+      #endif
+
+      #if ENABLED(FIXED_POINT_TRAPEZOIDS)
+        case 7: { // D7 Compare fixed-point and float trapezoids: C<count> S<seed>
+          // Float may round a distance to the wrong side of a whole step, so allow 1 step
+          constexpr uint32_t allowed_diff = 1;
+          const uint16_t count = parser.ushortval('C', 1000);
+          randomSeed(parser.ulongval('S', 1));
+          uint16_t differ = 0;
+          uint32_t max_diff = 0, float_us = 0, fixed_us = 0;
+          block_t block{};
+          for (uint16_t i = 0; i < count; i++) {
+            // A random move within the step rates and accelerations of common machines
+            block.step_event_count = random(1, 20000);
+            block.nominal_rate = random(120, 40000);
+            block.acceleration_steps_per_s2 = random(100, 400000);
+            const uint32_t initial_rate = random(120, block.nominal_rate + 1),
+                           final_rate = random(120, block.nominal_rate + 1);
+
+            uint32_t float_accel, float_plateau, fixed_accel, fixed_plateau,
+                     us = HAL_PROFILE_MICROS();
+            planner.trapezoid_steps_float(&block, initial_rate, final_rate, float_accel, float_plateau);
+            float_us += HAL_PROFILE_MICROS() - us;
+            us = HAL_PROFILE_MICROS();
+            planner.trapezoid_steps_fixed(&block, initial_rate, final_rate, fixed_accel, fixed_plateau);
+            fixed_us += HAL_PROFILE_MICROS() - us;
+
+            // Compare where acceleration ends and deceleration begins
+            const uint32_t diff = _MAX(ABS(int32_t(fixed_accel - float_accel)),
+                                       ABS(int32_t(fixed_accel + fixed_plateau - float_accel - float_plateau)));
+            if (diff) { differ++; NOLESS(max_diff, diff); }
+            idle();
+          }
+          SERIAL_ECHOPAIR("D7 C", count, " differ:", differ, " max:", max_diff, " float:", float_us, "us fixed:", fixed_us, "us");
+          serialprintPGM(max_diff <= allowed_diff ? PSTR(" match") : PSTR(" MISMATCH"));
+          SERIAL_EOL();
+        } break;
+      #endif
+
+      case 9: { // D9 Compare CRC-16 implementations: C<count> passes over a 128 byte block
+        uint16_t count = parser.ushortval('C', 100);
+        NOMORE(count, 1000U);
+        uint8_t block[128];
+        LOOP_L_N(i, sizeof(block)) block[i] = random(256);
+
+        uint16_t bitwise_crc = 0, table_crc = 0;
+        uint32_t us = HAL_PROFILE_MICROS();
+        for (uint16_t i = count; i--;) crc16_bitwise(&bitwise_crc, block, sizeof(block));
+        const uint32_t bitwise_us = HAL_PROFILE_MICROS() - us;
+
+        us = HAL_PROFILE_MICROS();
+        for (uint16_t i = count; i--;) crc16_table(&table_crc, block, sizeof(block));
+        const uint32_t table_us = HAL_PROFILE_MICROS() - us;
+
+        SERIAL_ECHOPAIR("D9 C", count, " bytes:", uint32_t(count) * sizeof(block),
+                        " bitwise:", bitwise_us, "us table:", table_us, "us");
+        bool match = table_crc == bitwise_crc;
+
+        #if ENABLED(HARDWARE_CRC16)
+          uint16_t hardware_crc = 0;
+          us = HAL_PROFILE_MICROS();
+          for (uint16_t i = count; i--;) HAL_crc16(&hardware_crc, block, sizeof(block));
+          SERIAL_ECHOPAIR(" hardware:", HAL_PROFILE_MICROS() - us, "us");
+          match &= hardware_crc == bitwise_crc;
+        #endif
+
+        serialprintPGM(match ? PSTR(" match") : PSTR(" MISMATCH"));
+        SERIAL_EOL();
+      } break;
+
+      #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+        case 10: { // D10 Laser energy per mm along an X move: X<distance> F<feedrate> S<power>
+          const float dist = parser.floatval('X', 10);
+          const feedRate_t fr_mm_s = parser.seenval('F') ? parser.value_feedrate() : 50;
+          const uint8_t power = _MAX(parser.byteval('S', 255), uint8_t(1));
+          constexpr uint16_t sample_us = 20, windows = 20;
+
+          // The power is sampled in a busy loop without idle(), so keep the move short.
+          // A move from rest to rest accelerates to the feedrate, or to the middle of a short move.
+          const float accel = _MIN(planner.settings.travel_acceleration, float(planner.settings.max_acceleration_mm_per_s2[X_AXIS])),
+                      v = _MIN(fr_mm_s, planner.settings.max_feedrate_mm_s[X_AXIS]),
+                      move_time = ABS(dist) >= sq(v) / accel ? ABS(dist) / v + v / accel : 2 * SQRT(ABS(dist) / accel);
+          if (move_time > 1) {
+            SERIAL_ECHOLNPGM("?D10 move must take under 1s. Lower X or raise F.");
+            break;
+          }
+
+          planner.synchronize();
+          const laser_state_t old_inline = planner.laser_inline;
+          planner.laser_inline.status.isEnabled = true;
+          planner.laser_inline.power = power;
+          xyze_pos_t end = current_position;
+          end.x += dist;
+          planner.buffer_line(end, fr_mm_s, active_extruder);
+          planner.laser_inline = old_inline;
+          current_position = end;
+
+          // Sample the laser power, summing power x elapsed time over each 1/20 of the move
+          const float steps_per_mm = planner.settings.axis_steps_per_mm[X_AXIS];
+          const int32_t start = stepper.position(X_AXIS),
+                        window = _MAX(int32_t(ABS(dist) * steps_per_mm / windows), 1L);
+          int32_t window_start = -1;
+          uint32_t energy = 0, last_us = micros();  // Power x microseconds
+          float min_ratio = 1e9, max_ratio = 0;
+          while (planner.has_blocks_queued()) {
+            watchdog_refresh();
+            DELAY_US(sample_us);
+            const uint32_t now = micros(), elapsed = now - last_us;
+            last_us = now;
+            const int32_t moved = ABS(stepper.position(X_AXIS) - start);
+            if (!moved) continue;
+            if (window_start < 0) window_start = moved; // Measure from the first step
+            energy += cutter.power * elapsed;
+            if (moved - window_start >= window) {
+              // Energy per mm of this window over the energy per mm at nominal power and speed
+              const float ratio = energy * 1e-6f * steps_per_mm * fr_mm_s / ((moved - window_start) * float(power));
+              NOMORE(min_ratio, ratio);
+              NOLESS(max_ratio, ratio);
+              window_start = moved;
+              energy = 0;
+            }
+          }
+          cutter.set_ocr_power(0);
+
+          SERIAL_ECHOLNPAIR("D10 X", dist, " F", LROUND(MMS_TO_MMM(fr_mm_s)), " S", power,
+            " energy/mm min:", LROUND(min_ratio * 100), "% max:", LROUND(max_ratio * 100), "%");
+        } break;
+      #endif
+
       case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
         SERIAL_ECHOLNPGM("Disabling heaters and attempting to trigger Watchdog");
         SERIAL_ECHOLNPGM("(USE_WATCHDOG " TERN(USE_WATCHDOG, "ENABLED", "DISABLED") ")");
@@ -123,6 +123,9 @@ void GcodeSuite::M115() {
     // LONG_FILENAME_HOST_SUPPORT (M33)
     cap_line(PSTR("LONG_FILENAME"), ENABLED(LONG_FILENAME_HOST_SUPPORT));
 
+    // SD_PAGED_LISTING (M20 S)
+    cap_line(PSTR("PAGED_LISTING"), ENABLED(SD_PAGED_LISTING));
+
     // THERMAL_PROTECTION
     cap_line(PSTR("THERMAL_PROTECTION"), ENABLED(THERMALLY_SAFE));
 
@@ -48,6 +48,14 @@
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With ARC_MAX_CHORD_ERROR the segment length grows with the radius, so large
+ * arcs take fewer planner blocks while staying as close to the true arc.
+ *
+ * With ARC_PLANNER_BLOCKS an XY arc is queued as a single planner block and the
+ * Stepper ISR steps along the segments as chords. Arcs are still queued as line
+ * segments while bed leveling is active, since leveling bends them out of the XY
+ * plane, outside the XY plane, and when the full circle passes the soft endstops.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -127,6 +135,9 @@ void plan_arc(
       constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
     #elif ARC_SEGMENTS_PER_SEC
       _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+    #elif defined(ARC_MAX_CHORD_ERROR)
+      // Longest chord with its midpoint no further than ARC_MAX_CHORD_ERROR from the arc
+      radius > (ARC_MAX_CHORD_ERROR) ? _MAX(2 * SQRT((ARC_MAX_CHORD_ERROR) * (2 * radius - (ARC_MAX_CHORD_ERROR))), MM_PER_ARC_SEGMENT) : MM_PER_ARC_SEGMENT
     #else
       MM_PER_ARC_SEGMENT
     #endif
@@ -136,6 +147,32 @@ void plan_arc(
   NOLESS(segments, min_segments);         // At least some segments
   seg_length = mm_of_travel / segments;
 
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    // Queue the arc as one block if it's in the XY plane. The block
+    // can't be clipped, so the whole circle must be within the limits.
+    if (TERN1(CNC_WORKSPACE_PLANES, p_axis == X_AXIS)) {
+      xyze_pos_t target = cart;
+      TERN_(AUTO_BED_LEVELING_UBL, target[l_axis] = start_L);
+      apply_motion_limits(target);
+
+      bool inside = true;
+      #if HAS_SOFTWARE_ENDSTOPS
+        xyz_pos_t lo = { center_P - radius, center_Q - radius, target.z },
+                  hi = { center_P + radius, center_Q + radius, target.z };
+        const xyz_pos_t lo0 = lo, hi0 = hi;
+        apply_motion_limits(lo);
+        apply_motion_limits(hi);
+        inside = lo == lo0 && hi == hi0;
+      #endif
+
+      const xy_pos_t center = { center_P, center_Q };
+      if (inside && planner.buffer_arc(target, center, rvec, angular_travel / segments, segments, scaled_fr_mm_s, active_extruder, mm_of_travel)) {
+        current_position = target;
+        return;
+      }
+    }
+  #endif
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
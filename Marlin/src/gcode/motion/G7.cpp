@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../feature/laser_raster.h"
+#include "../../feature/spindle_laser.h"
+
+#include "../../MarlinCore.h" // for IsRunning()
+
+/**
+ * G7: Raster Engraving Move
+ *
+ * Engrave the pixels sent with M580 along a straight XY move,
+ * with the laser power following each pixel in step with the motion.
+ *
+ *  X, Y - The end of the scanline
+ *  F    - Feedrate of the scanline
+ *  S    - Power for a full (255) pixel. (Default: Maximum power)
+ */
+void GcodeSuite::G7() {
+  if (!IsRunning()) return;
+
+  if (!laser_raster.pending()) {
+    SERIAL_ECHOLNPGM("?No raster pixels (M580).");
+    return;
+  }
+
+  const laser_state_t old_inline = planner.laser_inline;
+
+  get_destination_from_command();
+
+  const cutter_power_t upwr = parser.seenval('S')
+    ? cutter.power_to_range(cutter_power_t(round(parser.value_float())))
+    : cutter.mpower_max();
+
+  planner.laser_inline.status.isEnabled = true;
+  planner.laser_inline.power = cutter.upower_to_ocr(upwr);
+  planner.laser_inline.raster = laser_raster.queue_line() + 1;
+
+  apply_motion_limits(destination);
+  planner.buffer_line(destination, MMS_SCALED(feedrate_mm_s), active_extruder);
+  current_position = destination;
+
+  // Later moves don't engrave the raster
+  planner.laser_inline = old_inline;
+}
+
+#endif // LASER_RASTER
@@ -47,6 +47,10 @@ char *GCodeParser::command_ptr,
 char GCodeParser::command_letter;
 int GCodeParser::codenum;
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  bool GCodeParser::binary_values;
+#endif
+
 #if ENABLED(USE_GCODE_SUBCODES)
   uint8_t GCodeParser::subcode;
 #endif
@@ -80,6 +84,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(BINARY_GCODE_STREAM, binary_values = false); // Values are text
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -244,6 +249,9 @@ void GCodeParser::parse(char *p) {
     #if ENABLED(EXPECTED_PRINTER_CHECK)
       case 16:
     #endif
+    #if ENABLED(LASER_RASTER)
+      case 580:
+    #endif
     case 23: case 28: case 30: case 117 ... 118: case 928:
       string_arg = unescape_string(p);
       return;
@@ -337,10 +345,89 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  // Populate all fields from a pre-parsed binary command.
+  // The binary stream has already validated the command.
+  void GCodeParser::parse_binary(char * const p) {
+    static char no_string[] = "";
+
+    reset();
+    command_ptr = p;
+    command_letter = p[1];
+    codenum = int16_t(uint8_t(p[2]) | (uint8_t(p[3]) << 8));
+    TERN_(USE_GCODE_SUBCODES, subcode = p[4]);
+    string_arg = no_string;               // Commands that want a string get an empty one
+    binary_values = true;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    char *v = p + 6;
+    for (uint8_t n = p[5]; n--; v += 5) {
+      float f;
+      memcpy(&f, v + 1, sizeof(f));
+      set(v[0], isnan(f) ? nullptr : v + 1);
+    }
+  }
+
+  bool GCodeParser::binary_to_text(const char * const p, char * const buf, const size_t size) {
+    char *out = buf;
+    const char * const end = buf + size - 1;  // Leave room for the nul
+
+    // Append a string if it fits
+    auto append = [&](const char *str) {
+      const size_t len = strlen(str);
+      if (out + len > end) return false;
+      memcpy(out, str, len);
+      out += len;
+      return true;
+    };
+
+    char str[64];
+    const int16_t code = int16_t(uint8_t(p[2]) | (uint8_t(p[3]) << 8));
+    if (p[4])
+      sprintf_P(str, PSTR("%c%i.%i"), p[1], code, int(uint8_t(p[4])));
+    else
+      sprintf_P(str, PSTR("%c%i"), p[1], code);
+    if (!append(str)) return false;
+
+    const char *v = p + 6;
+    for (uint8_t n = p[5]; n--; v += 5) {
+      str[0] = ' ';
+      str[1] = v[0];
+      str[2] = '\0';
+      float f;
+      memcpy(&f, v + 1, sizeof(f));
+      if (!isnan(f)) {
+        // Up to 5 decimal places, without trailing zeros
+        char *s = dtostrf(f, 1, 5, &str[2]);
+        if (strchr(s, '.')) for (char *e = s + strlen(s) - 1; *e == '0' || *e == '.'; e--) {
+          const bool dot = *e == '.';
+          *e = '\0';
+          if (dot) break;
+        }
+      }
+      if (!append(str)) return false;
+    }
+
+    *out = '\0';
+    return true;
+  }
+
+#endif // BINARY_GCODE_STREAM
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(BINARY_GCODE_STREAM, binary_values)) return false; // Binary commands aren't chained
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -358,6 +445,16 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(BINARY_GCODE_STREAM)
+    if (binary_values) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+      SERIAL_CHAR(command_letter);
+      SERIAL_ECHO(codenum);
+      SERIAL_ECHOLNPGM("\"");
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
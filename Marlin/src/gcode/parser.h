@@ -42,6 +42,17 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  /**
+   * A pre-parsed command from the binary G-code stream, as queued:
+   *   BINARY_COMMAND_MARK, letter, code (int16), subcode, parameter count,
+   *   then each parameter as a letter and a float (NAN for no value).
+   * Numbers are little-endian, like all supported MCUs.
+   */
+  #define BINARY_COMMAND_MARK 0x01
+  #define BINARY_COMMAND_SIZE(P) (6 + 5 * uint8_t((P)[5]))
+#endif
+
 /**
  * GCode parser
  *
@@ -59,6 +70,10 @@ class GCodeParser {
 private:
   static char *value_ptr;           // Set by seen, used to fetch the value
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    static bool binary_values;      // Values are floats from a pre-parsed command
+  #endif
+
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
@@ -149,7 +164,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = TERN0(BINARY_GCODE_STREAM, binary_values) || valid_number(ptr) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -239,6 +254,14 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    // Populate all fields from a pre-parsed binary command
+    static void parse_binary(char * const p);
+
+    // Write a pre-parsed binary command as a line of text. Return false if it doesn't fit.
+    static bool binary_to_text(const char * const p, char * const buf, const size_t size);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -255,6 +278,13 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(BINARY_GCODE_STREAM)
+      if (binary_values) {
+        float f = 0;
+        if (value_ptr) memcpy(&f, value_ptr, sizeof(f));
+        return f;
+      }
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -274,8 +304,13 @@ public:
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(BINARY_GCODE_STREAM)
+    static inline int32_t value_long() { return binary_values ? int32_t(value_float()) : value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static inline uint32_t value_ulong() { return binary_values ? uint32_t(value_float()) : value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #else
+    static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -71,7 +71,13 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  char GCodeQueue::command_pool[COMMAND_QUEUE_BYTES];
+  uint16_t GCodeQueue::command_start[BUFSIZE],
+           GCodeQueue::pool_w = 0;
+#else
+  char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#endif
 
 /*
  * The port that the command was received on
@@ -100,6 +106,19 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if ENABLED(SD_PREFETCH_COMMANDS)
+  /**
+   * SD prefetch buffer. A ring of cleaned-up lines from the print file, each
+   * stored as a string followed by the SD position after the line.
+   */
+  #define PREFETCH_POS_SIZE int(sizeof(uint32_t))
+  static char prefetch_buffer[SD_PREFETCH_BYTES];
+  static uint16_t prefetch_r, prefetch_w,   // Ring read and write offsets
+                  prefetch_bytes,           // Bytes used
+                  prefetch_lines;           // Lines ready for the queue
+  uint32_t GCodeQueue::sd_queued_pos;       // = 0
+#endif
+
 GCodeQueue::GCodeQueue() {
   // Send "ok" after commands by default
   LOOP_L_N(i, COUNT(send_ok)) send_ok[i] = true;
@@ -117,6 +136,40 @@ bool GCodeQueue::has_commands_queued() {
  */
 void GCodeQueue::clear() {
   index_r = index_w = length = 0;
+  TERN_(PACKED_COMMAND_QUEUE, pool_w = 0);
+  TERN_(SD_PREFETCH_COMMANDS, prefetch_r = prefetch_w = prefetch_bytes = prefetch_lines = 0);
+}
+
+#if ENABLED(PACKED_COMMAND_QUEUE)
+
+  /**
+   * Check for a free slot and MAX_CMD_SIZE free bytes at pool_w,
+   * wrapping pool_w to the start of the pool if that has room instead.
+   * Only call this between commands, never with a command half-written.
+   */
+  bool GCodeQueue::has_space() {
+    if (length >= BUFSIZE) return false;
+    if (!length) { pool_w = 0; return true; }
+    // The oldest command is the start of the used part of the pool.
+    // Keep a gap before it so pool_w never catches up with it.
+    const uint16_t tail = command_start[index_r];
+    if (pool_w < tail) return tail - pool_w > MAX_CMD_SIZE;
+    if (pool_w + MAX_CMD_SIZE <= COMMAND_QUEUE_BYTES) return true;
+    if (tail <= MAX_CMD_SIZE) return false;
+    pool_w = 0;
+    return true;
+  }
+
+#endif
+
+/**
+ * The number of bytes a queued command takes
+ */
+inline size_t command_size(const char * const cmd) {
+  #if ENABLED(BINARY_GCODE_STREAM)
+    if (*cmd == BINARY_COMMAND_MARK) return BINARY_COMMAND_SIZE(cmd);
+  #endif
+  return strlen(cmd) + 1;
 }
 
 /**
@@ -127,6 +180,10 @@ void GCodeQueue::_commit_command(bool say_ok
     , int16_t p/*=-1*/
   #endif
 ) {
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    command_start[index_w] = pool_w;
+    pool_w += command_size(&command_pool[pool_w]);
+  #endif
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
@@ -144,8 +201,8 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
     , int16_t pn/*=-1*/
   #endif
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  if (*cmd == ';' || !has_space()) return false;
+  memcpy(next_command(), cmd, command_size(cmd));
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -154,6 +211,22 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   return true;
 }
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  /**
+   * Enqueue a command from the binary stream, which is acknowledged
+   * per packet instead of with an "ok" for each command.
+   */
+  bool GCodeQueue::enqueue_stream(const char * const cmd) {
+    return _enqueue(cmd, false
+      #if HAS_MULTI_SERIAL
+        , card.transfer_port_index
+      #endif
+    );
+  }
+
+#endif
+
 #define ISEOL(C) ((C) == '\n' || (C) == '\r')
 
 /**
@@ -286,7 +359,7 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
+    char* p = command(index_r);
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
@@ -359,7 +432,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -415,7 +488,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;
   buff[ind] = 0;
   if (ind) { ind = 0; return false; }
@@ -439,6 +512,7 @@ void GCodeQueue::get_serial_commands() {
        * For binary stream file transfer, use serial_line_buffer as the working
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
+       * BINARY_GCODE_STREAM has its own packet buffers of BINARY_STREAM_PACKET_SIZE.
        */
       binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
       return;
@@ -459,7 +533,7 @@ void GCodeQueue::get_serial_commands() {
   /**
    * Loop while serial characters are incoming and the queue is not full
    */
-  while (length < BUFSIZE && serial_data_available()) {
+  while (has_space() && serial_data_available()) {
     LOOP_L_N(i, NUM_SERIAL) {
 
       const int c = read_serial(i);
@@ -563,6 +637,92 @@ void GCodeQueue::get_serial_commands() {
 
 #if ENABLED(SDSUPPORT)
 
+  #if ENABLED(SD_PREFETCH_COMMANDS)
+
+  inline void prefetch_put(const char c) {
+    prefetch_buffer[prefetch_w] = c;
+    if (++prefetch_w >= SD_PREFETCH_BYTES) prefetch_w = 0;
+    prefetch_bytes++;
+  }
+
+  inline char prefetch_get() {
+    const char c = prefetch_buffer[prefetch_r];
+    if (++prefetch_r >= SD_PREFETCH_BYTES) prefetch_r = 0;
+    prefetch_bytes--;
+    return c;
+  }
+
+  /**
+   * Drop the prefetched lines, as when the file or its position changes.
+   * Reading picks up from the current SD position.
+   */
+  void GCodeQueue::sd_prefetch_clear() {
+    prefetch_r = prefetch_w = prefetch_bytes = prefetch_lines = 0;
+    sd_queued_pos = card.getIndex();
+  }
+
+  /**
+   * Read whole lines from the file being printed into the prefetch buffer
+   * until it's full or the end of the file is reached. Comments are removed
+   * and so are leading and trailing spaces, so only commands are stored.
+   * Called from idle() so lines are ready when the queue has room.
+   */
+  void GCodeQueue::sd_prefetch() {
+    static char sd_line[MAX_CMD_SIZE];
+
+    if (!IS_SD_PRINTING()) return;
+
+    uint8_t sd_input_state = PS_NORMAL;
+    int sd_count = 0;
+    bool card_eof = card.eof();
+    while (!card_eof && (sd_count || sd_input_state != PS_NORMAL
+      || SD_PREFETCH_BYTES - prefetch_bytes >= MAX_CMD_SIZE + PREFETCH_POS_SIZE)
+    ) {
+      const int16_t n = card.get();
+      card_eof = card.eof();
+      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+      const char sd_char = (char)n;
+      const bool is_eol = ISEOL(sd_char);
+      if (n >= 0 && !is_eol && (sd_count || sd_input_state != PS_NORMAL || sd_char != ' '))
+        process_stream_char(sd_char, sd_input_state, sd_line, sd_count);
+
+      if (is_eol || card_eof) {
+        while (sd_count && sd_line[sd_count - 1] == ' ') sd_count--;
+        if (!process_line_done(sd_input_state, sd_line, sd_count)) {
+          for (char *c = sd_line; *c; c++) prefetch_put(*c);
+          prefetch_put('\0');
+          const uint32_t sdpos = card.getIndex();
+          LOOP_L_N(i, sizeof(sdpos)) prefetch_put(((char*)&sdpos)[i]);
+          prefetch_lines++;
+        }
+      }
+    }
+  }
+
+  /**
+   * Move prefetched lines from the SD Card into the command buffer
+   * until it's full. Once all lines are queued handle the end of file.
+   */
+  inline void GCodeQueue::get_sdcard_commands() {
+    if (!IS_SD_PRINTING()) return;
+
+    sd_prefetch();
+
+    while (prefetch_lines && has_space()) {
+      char *cmd = next_command();
+      while ((*cmd++ = prefetch_get())) { /* nada */ }
+      _commit_command(false);
+      LOOP_L_N(i, sizeof(sd_queued_pos)) ((char*)&sd_queued_pos)[i] = prefetch_get();
+      TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = sd_queued_pos); // Prime for the NEXT _commit_command
+      prefetch_lines--;
+    }
+
+    if (!prefetch_lines && card.eof()) card.fileHasFinished();
+  }
+
+  #else
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -576,7 +736,7 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
+    while (!card_eof && (sd_count || has_space())) {
       const int16_t n = card.get();
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -587,7 +747,7 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+        if (!process_line_done(sd_input_state, next_command(), sd_count)) {
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
@@ -597,11 +757,13 @@ void GCodeQueue::get_serial_commands() {
         if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+        process_stream_char(sd_char, sd_input_state, next_command(), sd_count);
 
     }
   }
 
+  #endif // !SD_PREFETCH_COMMANDS
+
 #endif // SDSUPPORT
 
 /**
@@ -631,7 +793,18 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = queue.command(index_r);
+      #if ENABLED(BINARY_GCODE_STREAM)
+        // Save pre-parsed commands as text, with room for write_command to add CR/LF
+        char text[MAX_CMD_SIZE + 3];
+        if (*command == BINARY_COMMAND_MARK) {
+          if (!parser.binary_to_text(command, text, sizeof(text) - 2)) {
+            SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+            *text = '\0'; // Too long to save
+          }
+          command = text;
+        }
+      #endif
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
@@ -650,7 +823,7 @@ void GCodeQueue::advance() {
       }
       else {
         // Write the string from the read buffer to SD
-        card.write_command(command);
+        if (*command) card.write_command(command);
         if (card.flag.logging)
           gcode.process_next_command(); // The card is saving because it's logging
         else
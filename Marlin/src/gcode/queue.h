@@ -50,7 +50,18 @@ public:
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    /**
+     * With PACKED_COMMAND_QUEUE the commands are stored end-to-end in a
+     * single pool, and command_start[] holds the pool offset of each one.
+     */
+    static char command_pool[COMMAND_QUEUE_BYTES];
+    static uint16_t command_start[BUFSIZE];
+    static inline char* command(const uint8_t i) { return &command_pool[command_start[i]]; }
+  #else
+    static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+    static inline char* command(const uint8_t i) { return command_buffer[i]; }
+  #endif
 
   /**
    * The port that the command was received on
@@ -112,6 +123,14 @@ public:
    */
   static void enqueue_now_P(PGM_P const cmd);
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    /**
+     * Enqueue a text or pre-parsed command from the binary stream
+     * and return 'true' if successful.
+     */
+    static bool enqueue_stream(const char * const cmd);
+  #endif
+
   /**
    * Check whether there are any commands yet to be executed
    */
@@ -130,6 +149,15 @@ public:
    */
   static void get_available_commands();
 
+  #if ENABLED(SD_PREFETCH_COMMANDS)
+    /**
+     * Read and clean up lines of the SD print file ahead of the queue
+     */
+    static void sd_prefetch();
+    static void sd_prefetch_clear();
+    static uint32_t sd_queued_pos;  // SD position after the last line put in the queue
+  #endif
+
   /**
    * Send an "ok" message to the host, indicating
    * that a command was successfully processed.
@@ -151,6 +179,16 @@ private:
 
   static uint8_t index_w;  // Ring buffer write position
 
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static uint16_t pool_w;  // Pool offset for the next command
+    static bool has_space();
+  #else
+    static inline bool has_space() { return length < BUFSIZE; }
+  #endif
+
+  // Where the next command goes. Call has_space() first.
+  static inline char* next_command() { return TERN(PACKED_COMMAND_QUEUE, &command_pool[pool_w], command_buffer[index_w]); }
+
   static void get_serial_commands();
 
   #if ENABLED(SDSUPPORT)
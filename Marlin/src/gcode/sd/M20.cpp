@@ -29,9 +29,41 @@
 
 /**
  * M20: List SD card to serial output
+ *
+ * With SD_PAGED_LISTING, list one page of the working folder instead:
+ *
+ *   S<index> - List items from <index> on, in folder order
+ *   C<count> - Items in the page. (Default and maximum SD_LISTING_PAGE)
+ *   B        - Binary page, as one line "Page:<record size>:<base64 sd_listing_record_t's>:<items>"
+ *   D<index> - First enter the folder at <index>
+ *   U        - First go up to the parent folder
+ *   R        - First go to the root folder
+ *
+ * Text items are "<index> <size> <DOSNAME>[/] [<long name>]".
+ * The page ends with "Next:<index>", or "Next:-1" after the last item.
  */
 void GcodeSuite::M20() {
   if (card.flag.mounted) {
+    #if ENABLED(SD_PAGED_LISTING)
+      if (parser.seen("SDUR")) {
+        if (parser.seen('R')) card.cdroot();
+        if (parser.seen('U')) card.cdup();
+        if (parser.seenval('D')) {
+          const uint16_t nr = parser.value_ushort();
+          if (!card.cdIndex(nr)) {
+            SERIAL_ECHO_MSG(STR_SD_CANT_ENTER_SUBDIR, nr);
+            return;
+          }
+        }
+        uint16_t count = parser.ushortval('C', SD_LISTING_PAGE);
+        NOMORE(count, SD_LISTING_PAGE);
+        SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
+        const int32_t next = card.lsPage(parser.ushortval('S'), count, parser.seen('B'));
+        SERIAL_ECHOLNPAIR("Next:", next);
+        SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
+        return;
+      }
+    #endif
     SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
     card.ls();
     SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
@@ -46,8 +46,9 @@ void GcodeSuite::M28() {
       while (*p == ' ') ++p;
     }
 
-    // Binary transfer mode
-    if ((card.flag.binary_mode = binary_mode)) {
+    // Binary transfer mode. A file write from the binary stream stays in binary mode.
+    if (binary_mode) {
+      card.flag.binary_mode = true;
       SERIAL_ECHO_MSG("Switching to Binary Protocol");
       TERN_(HAS_MULTI_SERIAL, card.transfer_port_index = queue.port[queue.index_r]);
     }
@@ -222,6 +222,10 @@
   #define CUTTER_UNIT_IS(V)    (_CUTTER_POWER(CUTTER_POWER_UNIT)    == _CUTTER_POWER(V))
 #endif
 
+#if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT) && !defined(LASER_POWER_INLINE_TRAPEZOID_CONT_PER)
+  #define LASER_POWER_INLINE_TRAPEZOID_CONT_PER 0
+#endif
+
 // Add features that need hardware PWM here
 #if ANY(FAST_PWM_FAN, SPINDLE_LASER_PWM)
   #define NEEDS_HARDWARE_PWM 1
@@ -447,6 +451,10 @@
   #endif
 #endif
 
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+#endif
+
 //
 // SD Card connection methods
 // Defined here so pins and sanity checks can use them
@@ -3026,6 +3026,22 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
         //  #warning "Combining LASER_POWER_INLINE_TRAPEZOID with S_CURVE_ACCELERATION may result in unintended behavior."
         //#endif
       #endif
+      #ifdef LASER_POWER_INLINE_TRAPEZOID_FLOOR
+        static_assert(WITHIN(LASER_POWER_INLINE_TRAPEZOID_FLOOR, 0, 255), "LASER_POWER_INLINE_TRAPEZOID_FLOOR must be from 0 to 255.");
+      #endif
+    #elif defined(LASER_POWER_INLINE_TRAPEZOID_FLOOR)
+      #error "LASER_POWER_INLINE_TRAPEZOID_FLOOR requires LASER_POWER_INLINE_TRAPEZOID."
+    #endif
+    #if ENABLED(LASER_RASTER)
+      #if DISABLED(SPINDLE_LASER_PWM)
+        #error "LASER_RASTER requires SPINDLE_LASER_PWM."
+      #elif IS_KINEMATIC
+        #error "LASER_RASTER is not compatible with DELTA or SCARA kinematics."
+      #elif ENABLED(STEP_EVENT_SCHEDULE)
+        #error "LASER_RASTER is not compatible with STEP_EVENT_SCHEDULE. (The power would lead the motion.)"
+      #endif
+      static_assert(WITHIN(LASER_RASTER_PIXELS, 1, 65535), "LASER_RASTER_PIXELS must be from 1 to 65535.");
+      static_assert(WITHIN(LASER_RASTER_LINES, 2, 254), "LASER_RASTER_LINES must be from 2 to 254.");
     #endif
     #if ENABLED(LASER_POWER_INLINE_INVERT)
       //#ifndef LASER_POWER_INLINE_INVERT_WARN
@@ -3040,7 +3056,7 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
       #error "SPINDLE_LASER_POWERDOWN_DELAY must be greater than 0."
     #elif ENABLED(LASER_MOVE_POWER)
       #error "LASER_MOVE_POWER requires LASER_POWER_INLINE."
-    #elif ANY(LASER_POWER_INLINE_TRAPEZOID, LASER_POWER_INLINE_INVERT, LASER_MOVE_G0_OFF, LASER_MOVE_POWER)
+    #elif ANY(LASER_POWER_INLINE_TRAPEZOID, LASER_POWER_INLINE_INVERT, LASER_MOVE_G0_OFF, LASER_MOVE_POWER, LASER_RASTER)
       #error "Enabled an inline laser feature without inline laser power being enabled."
     #endif
   #endif
@@ -3131,6 +3147,30 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
 
+/**
+ * TMC background status reads
+ */
+#if ENABLED(TMC_ASYNC_STATUS)
+  #if DISABLED(MONITOR_DRIVER_STATUS)
+    #error "TMC_ASYNC_STATUS requires MONITOR_DRIVER_STATUS."
+  #elif ENABLED(TMC_SERIAL_MULTIPLEXER)
+    #error "TMC_ASYNC_STATUS is not compatible with TMC_SERIAL_MULTIPLEXER."
+  #endif
+#endif
+
+/**
+ * TMC telemetry
+ */
+#if ENABLED(TMC_TELEMETRY)
+  #if !HAS_TRINAMIC_CONFIG
+    #error "TMC_TELEMETRY requires TMC stepper drivers."
+  #elif !WITHIN(TMC_TELEMETRY_BUFFER, 1, 255)
+    #error "TMC_TELEMETRY_BUFFER must be from 1 to 255."
+  #elif defined(__AVR__) && !defined(USBCON) && TX_BUFFER_SIZE < 32
+    #error "TMC_TELEMETRY requires a TX_BUFFER_SIZE of 32 or more on AVR."
+  #endif
+#endif
+
 // G60/G61 Position Save
 #if SAVED_POSITIONS > 256
   #error "SAVED_POSITIONS must be an integer from 0 to 256."
@@ -3179,6 +3219,219 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+/**
+ * Input Shaping
+ */
+#if HAS_SHAPING
+  #if IS_KINEMATIC
+    #error "INPUT_SHAPING_[XY] is not compatible with DELTA or SCARA kinematics."
+  #elif IS_CORE && !(CORE_IS_XY && BOTH(INPUT_SHAPING_X, INPUT_SHAPING_Y))
+    #error "INPUT_SHAPING_[XY] with CORE kinematics requires COREXY/COREYX and both INPUT_SHAPING_X and INPUT_SHAPING_Y."
+  #elif ENABLED(MARKFORGED_XY)
+    #error "INPUT_SHAPING_[XY] is not compatible with MARKFORGED_XY."
+  #elif !(CORE_IS_XY || (IS_CARTESIAN && !IS_CORE))
+    #error "INPUT_SHAPING_[XY] requires Cartesian or COREXY/COREYX kinematics."
+  #elif ANY(LASER_POWER_INLINE_TRAPEZOID, LASER_RASTER)
+    #error "INPUT_SHAPING_[XY] is not compatible with LASER_POWER_INLINE_TRAPEZOID or LASER_RASTER. (The power would lead the shaped motion.)"
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "INPUT_SHAPING_[XY] is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(INPUT_SHAPING_X) && !HAS_X_STEP
+    #error "INPUT_SHAPING_X requires an X stepper."
+  #elif ENABLED(INPUT_SHAPING_Y) && !HAS_Y_STEP
+    #error "INPUT_SHAPING_Y requires a Y stepper."
+  #endif
+  static_assert((SHAPING_MIN_FREQ) > 0, "SHAPING_MIN_FREQ must be greater than 0.");
+  static_assert((SHAPING_MAX_STEPRATE) * 1.25f / (SHAPING_MIN_FREQ) < 32768, "SHAPING_MAX_STEPRATE / SHAPING_MIN_FREQ is too large for the step buffer.");
+  #ifdef __AVR__
+    // Each shaped axis keeps 4 bytes per step in its step buffer
+    static_assert((ENABLED(INPUT_SHAPING_X) + ENABLED(INPUT_SHAPING_Y)) * 4 * ((SHAPING_MAX_STEPRATE) * 1.25f / (SHAPING_MIN_FREQ) + 1) <= 2048,
+      "The input shaping step buffers need more than 2K of SRAM. Lower SHAPING_MAX_STEPRATE or raise SHAPING_MIN_FREQ.");
+  #endif
+  #if CORE_IS_XY
+    static_assert((SHAPING_FREQ_X) == (SHAPING_FREQ_Y) && (SHAPING_ZETA_X) == (SHAPING_ZETA_Y),
+      "COREXY/COREYX input shaping requires the same SHAPING_FREQ and SHAPING_ZETA on X and Y.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert((SHAPING_FREQ_X) == 0 || (SHAPING_FREQ_X) >= (SHAPING_MIN_FREQ), "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99f), "SHAPING_ZETA_X must be from 0 to 0.99.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert((SHAPING_FREQ_Y) == 0 || (SHAPING_FREQ_Y) >= (SHAPING_MIN_FREQ), "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.99f), "SHAPING_ZETA_Y must be from 0 to 0.99.");
+  #endif
+#endif
+
+/**
+ * Step Event Schedule
+ */
+#if ENABLED(STEP_EVENT_SCHEDULE)
+  #if ENABLED(DIRECT_STEPPING)
+    #error "STEP_EVENT_SCHEDULE is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "STEP_EVENT_SCHEDULE is not compatible with MIXING_EXTRUDER."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "STEP_EVENT_SCHEDULE is not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    #error "STEP_EVENT_SCHEDULE is not compatible with LASER_POWER_INLINE_TRAPEZOID. (The power would lead the motion.)"
+  #endif
+  static_assert(WITHIN(STEP_SCHEDULE_SIZE, 16, 128) && !((STEP_SCHEDULE_SIZE) & ((STEP_SCHEDULE_SIZE) - 1)), "STEP_SCHEDULE_SIZE must be a power of 2 from 16 to 128.");
+  static_assert((STEP_SCHEDULE_HORIZON) > 0, "STEP_SCHEDULE_HORIZON must be greater than 0.");
+  static_assert(WITHIN(STEP_SCHEDULE_CHUNK, 1, 64), "STEP_SCHEDULE_CHUNK must be from 1 to 64.");
+#endif
+
+/**
+ * Stepper ISR Profiling
+ */
+#if ENABLED(STEPPER_ISR_PROFILING) && DISABLED(MARLIN_DEV_MODE)
+  #error "STEPPER_ISR_PROFILING requires MARLIN_DEV_MODE."
+#endif
+
+/**
+ * Main Loop Profiling
+ */
+#if ENABLED(LOOP_PROFILING) && !WITHIN(LOOP_PROFILE_GCODES, 1, 255)
+  #error "LOOP_PROFILE_GCODES must be from 1 to 255."
+#endif
+
+/**
+ * Arc segment length
+ */
+#if defined(ARC_MAX_CHORD_ERROR) && (defined(ARC_SEGMENTS_PER_R) || defined(ARC_SEGMENTS_PER_SEC))
+  #error "ARC_MAX_CHORD_ERROR can't be used with ARC_SEGMENTS_PER_R or ARC_SEGMENTS_PER_SEC."
+#endif
+
+/**
+ * Arc planner blocks
+ */
+#if ENABLED(ARC_PLANNER_BLOCKS)
+  #if IS_KINEMATIC || IS_CORE || ENABLED(MARKFORGED_XY)
+    #error "ARC_PLANNER_BLOCKS requires a Cartesian machine."
+  #elif ANY(STEP_EVENT_SCHEDULE, DIRECT_STEPPING, MIXING_EXTRUDER, BACKLASH_COMPENSATION, SKEW_CORRECTION)
+    #error "ARC_PLANNER_BLOCKS is not compatible with STEP_EVENT_SCHEDULE, DIRECT_STEPPING, MIXING_EXTRUDER, BACKLASH_COMPENSATION, or SKEW_CORRECTION."
+  #elif defined(__AVR__)
+    #error "ARC_PLANNER_BLOCKS requires a 32-bit processor."
+  #endif
+#endif
+
+/**
+ * Adaptive kinematic segments
+ */
+#if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+  #if !IS_KINEMATIC
+    #error "ADAPTIVE_KINEMATIC_SEGMENTS requires DELTA or SCARA."
+  #endif
+  static_assert(KINEMATIC_SEGMENT_ERROR > 0, "KINEMATIC_SEGMENT_ERROR must be greater than 0.");
+  static_assert(KINEMATIC_SEGMENT_MIN_LENGTH > 0 && KINEMATIC_SEGMENT_MIN_LENGTH < KINEMATIC_SEGMENT_MAX_LENGTH,
+    "KINEMATIC_SEGMENT_MIN_LENGTH must be greater than 0 and less than KINEMATIC_SEGMENT_MAX_LENGTH.");
+#endif
+
+/**
+ * Binary G-code stream
+ */
+#if ENABLED(BINARY_GCODE_STREAM)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE_STREAM requires FASTER_GCODE_PARSER."
+  #elif !defined(BINARY_STREAM_PACKET_SIZE) || !defined(BINARY_STREAM_WINDOW)
+    #error "BINARY_GCODE_STREAM requires BINARY_STREAM_PACKET_SIZE and BINARY_STREAM_WINDOW."
+  #elif !WITHIN(BINARY_STREAM_PACKET_SIZE, MAX_CMD_SIZE, 65535)
+    #error "BINARY_STREAM_PACKET_SIZE must be from MAX_CMD_SIZE to 65535."
+  #elif !WITHIN(BINARY_STREAM_WINDOW, 1, 16)
+    #error "BINARY_STREAM_WINDOW must be from 1 to 16."
+  #endif
+#endif
+
+/**
+ * Packed command queue
+ */
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #ifndef COMMAND_QUEUE_BYTES
+    #error "PACKED_COMMAND_QUEUE requires COMMAND_QUEUE_BYTES."
+  #elif COMMAND_QUEUE_BYTES < 2 * (MAX_CMD_SIZE)
+    #error "COMMAND_QUEUE_BYTES must be at least 2 * MAX_CMD_SIZE."
+  #elif COMMAND_QUEUE_BYTES > 65535
+    #error "COMMAND_QUEUE_BYTES must be 65535 or less."
+  #endif
+#endif
+
+/**
+ * SD read-ahead
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if ANY(SDIO_SUPPORT, USB_FLASH_DRIVE_SUPPORT)
+    #error "SD_READ_AHEAD is not compatible with SDIO_SUPPORT or USB_FLASH_DRIVE_SUPPORT."
+  #elif !defined(SD_READ_AHEAD_BLOCKS)
+    #error "SD_READ_AHEAD requires SD_READ_AHEAD_BLOCKS."
+  #elif !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 8)
+    #error "SD_READ_AHEAD_BLOCKS must be from 2 to 8."
+  #endif
+#endif
+
+/**
+ * SD cluster cache
+ */
+#if ENABLED(SD_CLUSTER_CACHE)
+  #ifndef SD_CLUSTER_CACHE_EXTENTS
+    #error "SD_CLUSTER_CACHE requires SD_CLUSTER_CACHE_EXTENTS."
+  #elif !WITHIN(SD_CLUSTER_CACHE_EXTENTS, 1, 255)
+    #error "SD_CLUSTER_CACHE_EXTENTS must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * SD command prefetch
+ */
+#if ENABLED(SD_PREFETCH_COMMANDS)
+  #ifndef SD_PREFETCH_BYTES
+    #error "SD_PREFETCH_COMMANDS requires SD_PREFETCH_BYTES."
+  #elif SD_PREFETCH_BYTES < MAX_CMD_SIZE + 4
+    #error "SD_PREFETCH_BYTES must be at least MAX_CMD_SIZE + 4."
+  #elif SD_PREFETCH_BYTES > 65535
+    #error "SD_PREFETCH_BYTES must be 65535 or less."
+  #endif
+#endif
+
+/**
+ * SD folder index
+ */
+#if BOTH(SD_DIR_INDEX, SDCARD_READONLY)
+  #error "SD_DIR_INDEX is not compatible with SDCARD_READONLY."
+#endif
+
+/**
+ * SD paged listing
+ */
+#if ENABLED(SD_PAGED_LISTING)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_PAGED_LISTING requires SDSUPPORT."
+  #endif
+  static_assert(WITHIN(SD_LISTING_PAGE, 1, 255), "SD_LISTING_PAGE must be from 1 to 255.");
+#endif
+
+/**
+ * Power-loss journal
+ */
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #ifndef POWER_LOSS_JOURNAL_SIZE
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_JOURNAL_SIZE."
+  #elif !WITHIN(POWER_LOSS_JOURNAL_SIZE, 1, 255)
+    #error "POWER_LOSS_JOURNAL_SIZE must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * Flash EEPROM log
+ */
+#if ENABLED(FLASH_EEPROM_LOG) && DISABLED(FLASH_EEPROM_LEVELING)
+  #error "FLASH_EEPROM_LOG requires FLASH_EEPROM_LEVELING."
+#endif
+
+/**
+ * Hardware CRC-16
+ */
+#if ENABLED(HARDWARE_CRC16) && !defined(HAL_CRC16)
+  #error "HARDWARE_CRC16 requires a CRC unit with a programmable polynomial."
+#endif
+
 /**
  * Sanity check for valid stepper driver types
  */
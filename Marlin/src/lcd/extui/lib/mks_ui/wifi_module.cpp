@@ -1287,6 +1287,7 @@ static void file_first_msg_handle(uint8_t * msg, uint16_t msgLen) {
     if (!fname) return;
     if (file.open(curDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       gCfgItems.curFilesize = file.fileSize();
+      TERN_(SD_DIR_INDEX, dir_index.invalidate());
     }
     else {
       clear_cur_ui();
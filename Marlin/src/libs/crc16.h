@@ -23,4 +23,6 @@
 
 #include <stdint.h>
 
-void crc16(uint16_t *crc, const void * const data, uint16_t cnt);
+void crc16(uint16_t *crc, const void * const data, uint16_t cnt);         // Table or hardware (HARDWARE_CRC16)
+void crc16_table(uint16_t *crc, const void * const data, uint16_t cnt);   // Table lookup
+void crc16_bitwise(uint16_t *crc, const void * const data, uint16_t cnt); // Bit by bit, for testing
@@ -720,6 +720,50 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     #define SCARA_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+
+    /**
+     * Get the length of the next segment of a kinematic move starting at 'start'
+     * and heading along the unit vector 'dir', with 'remaining_mm' left to go.
+     *
+     * The steppers move linearly in joint space, so the nozzle only follows the
+     * straight line at segment ends. Measure how far the joint-space midpoint of
+     * a candidate segment lands from the cartesian midpoint and shorten it until
+     * that is within KINEMATIC_SEGMENT_ERROR. The error grows with the square of
+     * the length, so one or two tries are usually enough. Start from 'guess_mm',
+     * the previous segment length, since curvature changes slowly along a move.
+     */
+    float kinematic_segment_mm(const xyz_pos_t &start, const xyz_float_t &dir, const float remaining_mm, const float guess_mm) {
+      inverse_kinematics(start);
+      const abc_pos_t start_joints = delta;
+
+      float segment_mm = _MIN(guess_mm * 2, remaining_mm, float(KINEMATIC_SEGMENT_MAX_LENGTH));
+      for (;;) {
+        if (segment_mm <= (KINEMATIC_SEGMENT_MIN_LENGTH)) return _MIN(float(KINEMATIC_SEGMENT_MIN_LENGTH), remaining_mm);
+
+        inverse_kinematics(start + dir * segment_mm);
+        const abc_pos_t mid_joints = (start_joints + delta) * 0.5f;
+        xyz_pos_t mid = start + dir * (segment_mm * 0.5f);
+
+        #if IS_SCARA
+          forward_kinematics_SCARA(mid_joints.a, mid_joints.b);
+          const float error = HYPOT(cartes.x - mid.x, cartes.y - mid.y);
+        #else
+          forward_kinematics_DELTA(mid_joints);
+          #if HAS_HOTEND_OFFSET
+            mid -= xy_pos_t(hotend_offset[active_extruder]); // Delta IK works on the effector position
+          #endif
+          const float error = (cartes - mid).magnitude();
+        #endif
+
+        if (error <= (KINEMATIC_SEGMENT_ERROR)) return segment_mm;
+
+        segment_mm *= 0.9f * SQRT((KINEMATIC_SEGMENT_ERROR) / error);
+      }
+    }
+
+  #endif
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -760,6 +804,36 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // No E move either? Game over.
     if (UNEAR_ZERO(cartesian_mm)) return true;
 
+    #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+
+      // Split only where the kinematics curve away from the straight line
+      const xyz_float_t dir = xyz_float_t(diff) * RECIPROCAL(cartesian_mm);
+      xyze_pos_t raw = current_position;
+      millis_t next_idle_ms = millis() + 200UL;
+      float done_mm = 0, segment_mm = KINEMATIC_SEGMENT_MAX_LENGTH;
+      for (;;) {
+        const float remaining_mm = cartesian_mm - done_mm;
+        segment_mm = kinematic_segment_mm(raw, dir, remaining_mm, segment_mm);
+        if (segment_mm >= remaining_mm) break;
+        done_mm += segment_mm;
+        segment_idle(next_idle_ms);
+        raw = current_position + diff * (done_mm / cartesian_mm);
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_mm
+          #if ENABLED(SCARA_FEEDRATE_SCALING)
+            , scaled_fr_mm_s / segment_mm
+          #endif
+        )) break;
+      }
+
+      // The last segment ends exactly at the destination
+      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, segment_mm
+        #if ENABLED(SCARA_FEEDRATE_SCALING)
+          , scaled_fr_mm_s / segment_mm
+        #endif
+      );
+
+    #else
+
     // Minimum number of seconds to move the given distance
     const float seconds = cartesian_mm / scaled_fr_mm_s;
 
@@ -814,6 +888,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       #endif
     );
 
+    #endif // !ADAPTIVE_KINEMATIC_SEGMENTS
+
     return false; // caller will update current_position
   }
 
@@ -244,6 +244,10 @@ inline void prepare_internal_move_to_destination(const feedRate_t &fr_mm_s=0.0f)
   }
 #endif
 
+#if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+  float kinematic_segment_mm(const xyz_pos_t &start, const xyz_float_t &dir, const float remaining_mm, const float guess_mm);
+#endif
+
 /**
  * Blocking movement and shorthand functions
  */
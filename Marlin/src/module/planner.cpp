@@ -196,6 +196,13 @@ float Planner::steps_to_mm[XYZE_N];             // (mm) Millimeters per step
 
 skew_factor_t Planner::skew_factor; // Initialized by settings.load()
 
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #define PROFILE_REPLAN(F) replan_profile.F++
+  Planner::replan_profile_t Planner::replan_profile;
+#else
+  #define PROFILE_REPLAN(F) NOOP
+#endif
+
 #if ENABLED(AUTOTEMP)
   float Planner::autotemp_max = 250,
         Planner::autotemp_min = 210,
@@ -765,6 +772,90 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+/**
+ * Get the number of steps to accelerate from 'initial_rate' and the number of steps
+ * to cruise before decelerating to 'final_rate'. Return false if the block is too
+ * short to reach its nominal rate, so it has no plateau.
+ */
+bool Planner::trapezoid_steps_float(const block_t * const block, const uint32_t initial_rate, const uint32_t final_rate, uint32_t &accelerate_steps, uint32_t &plateau_steps) {
+  const int32_t accel = block->acceleration_steps_per_s2;
+
+          // Steps required for acceleration, deceleration to/from nominal rate
+  accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel));
+  const uint32_t decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+          // Steps between acceleration and deceleration, if any
+  const int32_t plateau = block->step_event_count - accelerate_steps - decelerate_steps;
+  if (plateau >= 0) {
+    plateau_steps = plateau;
+    return true;
+  }
+
+  // Does accelerate_steps + decelerate_steps exceed step_event_count?
+  // Then we can't possibly reach the nominal rate, there will be no cruising.
+  // Use intersection_distance() to calculate accel / braking time in order to
+  // reach the final_rate exactly at the end of this block.
+  const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+  accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+  plateau_steps = 0;
+  return false;
+}
+
+#if ENABLED(FIXED_POINT_TRAPEZOIDS)
+
+  // Squared step rates. AVR can't step faster than 65535Hz, so 32 bits will do.
+  #ifdef __AVR__
+    typedef uint32_t rate_sq_t;
+    #define RATE_LIMIT(R) _MIN(R, uint32_t(UINT16_MAX))
+  #else
+    typedef uint64_t rate_sq_t;
+    #define RATE_LIMIT(R) (R)
+  #endif
+
+  /**
+   * trapezoid_steps_float() with integer math. The distances are exact, and
+   * rounded the same way, so they only differ where float loses precision.
+   * Then float can be one step off, which D7 allows.
+   */
+  bool Planner::trapezoid_steps_fixed(const block_t * const block, const uint32_t initial_rate, const uint32_t final_rate, uint32_t &accelerate_steps, uint32_t &plateau_steps) {
+    const uint32_t steps = block->step_event_count,
+                   accel2 = block->acceleration_steps_per_s2 * 2;
+    if (!accel2) {
+      accelerate_steps = 0;
+      plateau_steps = steps;
+      return true;
+    }
+
+    const uint32_t nominal_rate = RATE_LIMIT(block->nominal_rate),
+                   entry_rate = _MIN(RATE_LIMIT(initial_rate), nominal_rate),
+                   exit_rate = _MIN(RATE_LIMIT(final_rate), nominal_rate);
+    const rate_sq_t nominal_sq = rate_sq_t(nominal_rate) * nominal_rate,
+                    entry_sq = rate_sq_t(entry_rate) * entry_rate,
+                    exit_sq = rate_sq_t(exit_rate) * exit_rate;
+
+    // Steps to accelerate (rounded up) and to decelerate (rounded down) from / to the nominal rate
+    const rate_sq_t accel_sq = nominal_sq - entry_sq,
+                    accel_steps = accel_sq / accel2 + (accel_sq % accel2 != 0),
+                    decel_steps = (nominal_sq - exit_sq) / accel2;
+    if (accel_steps + decel_steps <= steps) {
+      accelerate_steps = accel_steps;
+      plateau_steps = steps - accel_steps - decel_steps;
+      return true;
+    }
+
+    // Acceleration and deceleration meet at (steps + (exit_sq - entry_sq) / accel2) / 2, rounded up
+    const bool faster_exit = exit_sq >= entry_sq;
+    const rate_sq_t diff_sq = faster_exit ? exit_sq - entry_sq : entry_sq - exit_sq,
+                    diff_steps = diff_sq / accel2;
+    const rate_sq_t meet = faster_exit ? (steps + diff_steps + 1 + (diff_sq % accel2 != 0)) / 2
+                         : diff_steps < steps ? (steps - diff_steps + 1) / 2 : 0;
+
+    accelerate_steps = _MIN(meet, rate_sq_t(steps));
+    plateau_steps = 0;
+    return false;
+  }
+
+#endif // FIXED_POINT_TRAPEZOIDS
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -784,44 +875,24 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
   NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
 
-  #if ENABLED(S_CURVE_ACCELERATION)
-    uint32_t cruise_rate = initial_rate;
-  #endif
+  PROFILE_REPLAN(trapezoids);
 
-  const int32_t accel = block->acceleration_steps_per_s2;
+  uint32_t accelerate_steps, plateau_steps;
+  const bool reaches_nominal = TERN(FIXED_POINT_TRAPEZOIDS, trapezoid_steps_fixed, trapezoid_steps_float)(block, initial_rate, final_rate, accelerate_steps, plateau_steps);
 
-          // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
-          // Steps between acceleration and deceleration, if any
-  int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
-
-  // Does accelerate_steps + decelerate_steps exceed step_event_count?
-  // Then we can't possibly reach the nominal rate, there will be no cruising.
-  // Use intersection_distance() to calculate accel / braking time in order to
-  // reach the final_rate exactly at the end of this block.
-  if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-    plateau_steps = 0;
-
-    #if ENABLED(S_CURVE_ACCELERATION)
-      // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
-    #endif
-  }
   #if ENABLED(S_CURVE_ACCELERATION)
-    else // We have some plateau time, so the cruise rate will be the nominal rate
-      cruise_rate = block->nominal_rate;
-  #endif
+    // If the nominal rate isn't reached, calculate the speed reached where deceleration begins
+    const int32_t accel = block->acceleration_steps_per_s2;
+    const uint32_t cruise_rate = reaches_nominal ? block->nominal_rate : final_speed(initial_rate, accel, accelerate_steps);
 
-  #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
     uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
              deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
              acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
+  #else
+    UNUSED(reaches_nominal);
   #endif
 
   // Store new block parameters
@@ -849,7 +920,12 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
    */
   #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
     if (block->laser.power > 0) { // No need to care if power == 0
-      const uint8_t entry_power = block->laser.power * entry_factor; // Power on block entry
+      uint8_t entry_power = block->laser.power * entry_factor; // Power on block entry
+      #ifdef LASER_POWER_INLINE_TRAPEZOID_FLOOR
+        // Don't scale under the power the laser needs to fire
+        const uint8_t power_floor = _MIN(uint8_t(LASER_POWER_INLINE_TRAPEZOID_FLOOR), block->laser.power);
+        NOLESS(entry_power, power_floor);
+      #endif
       #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
         // Speedup power
         const uint8_t entry_power_diff = block->laser.power - entry_power;
@@ -862,8 +938,11 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
           block->laser.power_entry = block->laser.power;
         }
         // Slowdown power
-        const uint8_t exit_power = block->laser.power * exit_factor, // Power on block entry
-                      exit_power_diff = block->laser.power - exit_power;
+        uint8_t exit_power = block->laser.power * exit_factor; // Power on block exit
+        #ifdef LASER_POWER_INLINE_TRAPEZOID_FLOOR
+          NOLESS(exit_power, power_floor);
+        #endif
+        const uint8_t exit_power_diff = block->laser.power - exit_power;
         if (exit_power_diff) {
           block->laser.exit_per = (block->step_event_count - block->decelerate_after) / exit_power_diff;
           block->laser.power_exit = exit_power;
@@ -1017,6 +1096,7 @@ void Planner::reverse_pass() {
 
     // Only consider non sync and page blocks
     if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
+      PROFILE_REPLAN(reverse);
       reverse_pass_kernel(current, next);
       next = current;
     }
@@ -1117,8 +1197,10 @@ void Planner::forward_pass() {
       // the previous block became BUSY, so assume the current block's
       // entry speed can't be altered (since that would also require
       // updating the exit speed of the previous block).
-      if (!previous || !stepper.is_block_busy(previous))
+      if (!previous || !stepper.is_block_busy(previous)) {
+        PROFILE_REPLAN(forward);
         forward_pass_kernel(previous, block, block_index);
+      }
       previous = block;
     }
     // Advance to the previous
@@ -1216,7 +1298,7 @@ void Planner::recalculate_trapezoids() {
     // But there is an inherent race condition here, as the block maybe
     // became BUSY, just before it was marked as RECALCULATE, so check
     // if that is the case!
-    if (!stepper.is_block_busy(block)) {
+    if (!stepper.is_block_busy(next)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
       const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
@@ -1238,6 +1320,10 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  #if ENABLED(STEPPER_ISR_PROFILING)
+    const uint32_t start_us = HAL_PROFILE_MICROS();
+    replan_profile.calls++;
+  #endif
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
@@ -1246,8 +1332,21 @@ void Planner::recalculate() {
     forward_pass();
   }
   recalculate_trapezoids();
+  TERN_(STEPPER_ISR_PROFILING, replan_profile.micros += HAL_PROFILE_MICROS() - start_us);
 }
 
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+  void Planner::report_replan_profile() {
+    const uint32_t n = _MAX(replan_profile.calls, 1U);
+    SERIAL_ECHOLNPAIR("Planner blocks:", replan_profile.calls, " us:", replan_profile.micros);
+    SERIAL_ECHOLNPAIR(" per block reverse:", float(replan_profile.reverse) / n,
+                      " forward:", float(replan_profile.forward) / n,
+                      " trapezoids:", float(replan_profile.trapezoids) / n);
+  }
+
+#endif
+
 #if ENABLED(AUTOTEMP)
 
   void Planner::getHighESpeed() {
@@ -1664,6 +1763,7 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 void Planner::synchronize() {
   while (has_blocks_queued() || cleaning_buffer_counter
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
+      || TERN0(HAS_SHAPING, stepper.shaping_busy())
   ) idle();
 }
 
@@ -1677,6 +1777,7 @@ void Planner::synchronize() {
  *  fr_mm_s       - (target) speed of the move
  *  extruder      - target extruder
  *  millimeters   - the length of the movement, if known
+ *  arc           - an XY arc to step along, if not a line
  *
  * Returns true if movement was properly queued, false otherwise (if cleaning)
  */
@@ -1688,6 +1789,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    , const arc_plan_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -1706,6 +1810,9 @@ bool Planner::_buffer_steps(const xyze_long_t &target
       , cart_dist_mm
     #endif
     , fr_mm_s, extruder, millimeters
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      , arc
+    #endif
   )) {
     // Movement was not queued, probably because it was too short.
     //  Simply accept that as movement queued and done
@@ -1740,6 +1847,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  arc         - an XY arc to step along, if not a line
  *
  * Returns true if movement is acceptable, false otherwise
  */
@@ -1752,6 +1860,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     , const xyze_float_t &cart_dist_mm
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    , const arc_plan_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   const int32_t da = target.a - position.a,
@@ -1852,6 +1963,8 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Clear all flags, including the "busy" bit
   block->flag = 0x00;
 
+  TERN_(ARC_PLANNER_BLOCKS, block->arc.chords = 0);
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -1860,6 +1973,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     laser_inline.status.isPlanned = true;
     block->laser.status = laser_inline.status;
     block->laser.power = laser_inline.power;
+    TERN_(LASER_RASTER, block->laser.raster = laser_inline.raster);
   #endif
 
   // Number of steps for each axis
@@ -1879,6 +1993,21 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->steps.set(ABS(da), ABS(db), ABS(dc));
   #endif
 
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    if (arc) {
+      // Give each chord enough step events for its X, Y, Z, and E steps, with
+      // room for the fixed point rounding. X and Y count as moving all along.
+      const uint16_t chords = arc->block.chords;
+      block->arc = arc->block;
+      block->arc.delta.set(da, db, dc, de < 0 ? -int32_t(esteps) : int32_t(esteps));
+      block->arc.rate_c = int64_t(block->arc.delta.c) * 256 / chords;
+      block->arc.rate_e = int64_t(block->arc.delta.e) * 256 / chords;
+      const uint32_t xy_events = CEIL(arc->chord_mm * _MAX(settings.axis_steps_per_mm[X_AXIS], settings.axis_steps_per_mm[Y_AXIS]));
+      block->arc.chord_events = _MAX(xy_events, (block->steps.c + chords - 1) / chords, (esteps + chords - 1) / chords) + 2 + chords / 256;
+      block->steps.a = block->steps.b = block->arc.chord_events * chords;
+    }
+  #endif
+
   /**
    * This part of the code calculates the total length of the movement.
    * For cartesian bots, the X_AXIS is the real X movement and same for Y_AXIS.
@@ -1924,6 +2053,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     steps_dist_mm.c = dc * steps_to_mm[C_AXIS];
   #endif
 
+  // Along an arc X and Y move at most at their peak share of the tangent
+  TERN_(ARC_PLANNER_BLOCKS, if (arc) { steps_dist_mm.x = arc->peak_mm.x; steps_dist_mm.y = arc->peak_mm.y; });
+
   #if EXTRUDERS
     steps_dist_mm.e = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #else
@@ -2204,6 +2336,17 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   #endif // XY_FREQUENCY_LIMIT
 
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    // Keep the centripetal acceleration of an arc within the XY acceleration
+    if (arc) {
+      const float accel_mm = _MIN(esteps ? settings.acceleration : settings.travel_acceleration,
+                                  settings.max_acceleration_mm_per_s2[X_AXIS], settings.max_acceleration_mm_per_s2[Y_AXIS]),
+                  max_speed_sqr = accel_mm * arc->radius,
+                  speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
+      if (speed_sqr > max_speed_sqr) speed_factor *= SQRT(max_speed_sqr / speed_sqr);
+    }
+  #endif
+
   // Correct the speed
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
@@ -2211,6 +2354,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+    // Laser power per step rate for the stepper to scale by the current rate
+    block->laser.power_rate = (uint32_t(block->laser.power) << 24) / block->nominal_rate;
+  #endif
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2227,12 +2375,22 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       } \
     }while(0)
 
-    #define LIMIT_ACCEL_FLOAT(AXIS,INDX) do{ \
-      if (block->steps[AXIS] && max_acceleration_steps_per_s2[AXIS+INDX] < accel) { \
-        const float comp = (float)max_acceleration_steps_per_s2[AXIS+INDX] * (float)block->step_event_count; \
-        if ((float)accel * (float)block->steps[AXIS] > comp) accel = comp / (float)block->steps[AXIS]; \
-      } \
-    }while(0)
+    #if ENABLED(FIXED_POINT_TRAPEZOIDS)
+      // 64-bit products instead of float, exact where float only keeps 24 bits
+      #define LIMIT_ACCEL_FLOAT(AXIS,INDX) do{ \
+        if (block->steps[AXIS] && max_acceleration_steps_per_s2[AXIS+INDX] < accel) { \
+          const uint64_t comp = uint64_t(max_acceleration_steps_per_s2[AXIS+INDX]) * block->step_event_count; \
+          if (uint64_t(accel) * block->steps[AXIS] > comp) accel = comp / block->steps[AXIS]; \
+        } \
+      }while(0)
+    #else
+      #define LIMIT_ACCEL_FLOAT(AXIS,INDX) do{ \
+        if (block->steps[AXIS] && max_acceleration_steps_per_s2[AXIS+INDX] < accel) { \
+          const float comp = (float)max_acceleration_steps_per_s2[AXIS+INDX] * (float)block->step_event_count; \
+          if ((float)accel * (float)block->steps[AXIS] > comp) accel = comp / (float)block->steps[AXIS]; \
+        } \
+      }while(0)
+    #endif
 
     // Start with print or travel acceleration
     accel = CEIL((esteps ? settings.acceleration : settings.travel_acceleration) * steps_per_mm);
@@ -2259,9 +2417,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #if IS_KINEMATIC
             block->millimeters
           #else
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (TERN0(ARC_PLANNER_BLOCKS, arc) ? block->millimeters : SQRT(sq(target_float.x - position_float.x)
+                                                                  + sq(target_float.y - position_float.y)
+                                                                  + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2295,7 +2453,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
-    block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
+    #if ENABLED(FIXED_POINT_TRAPEZOIDS)
+      // accel * 2^24 / STEPPER_TIMER_RATE with the factor rounded up in Q32
+      constexpr uint64_t accel_rate_q32 = ((1ULL << 56) + (STEPPER_TIMER_RATE) - 1) / (STEPPER_TIMER_RATE);
+      block->acceleration_rate = uint32_t((uint64_t(accel) * accel_rate_q32) >> 32);
+    #else
+      block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
+    #endif
   #endif
   #if ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
@@ -2357,16 +2521,29 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       #endif
     ;
 
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      // An arc starts and ends along its tangents
+      xyze_float_t exit_vec = unit_vec;
+      if (arc) {
+        unit_vec.set(arc->entry);
+        exit_vec.set(arc->exit);
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
-    if (EITHER(IS_CORE, MARKFORGED_XY) || esteps > 0)
+    if (EITHER(IS_CORE, MARKFORGED_XY) || esteps > 0) {
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
-    else
+      TERN_(ARC_PLANNER_BLOCKS, if (arc) normalize_junction_vector(exit_vec));
+    }
+    else {
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
+      TERN_(ARC_PLANNER_BLOCKS, if (arc) exit_vec *= inverse_millimeters);
+    }
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
@@ -2487,7 +2664,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
 
-    prev_unit_vec = unit_vec;
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      prev_unit_vec = arc ? exit_vec : unit_vec;
+    #else
+      prev_unit_vec = unit_vec;
+    #endif
 
   #endif
 
@@ -2507,6 +2688,16 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
      */
     CACHED_SQRT(nominal_speed, block->nominal_speed_sqr);
 
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      // An arc starts and ends with the XY speeds along its tangents
+      xy_float_t arc_exit_speed;
+      if (arc) {
+        const float tangent_secs = inverse_secs * speed_factor;
+        current_speed.set(arc->entry * tangent_secs);
+        arc_exit_speed = arc->exit * tangent_secs;
+      }
+    #endif
+
     // Exit speed limited by a jerk to full halt of a previous last segment
     static float previous_safe_speed;
 
@@ -2622,6 +2813,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if BOTH(ARC_PLANNER_BLOCKS, HAS_CLASSIC_JERK)
+    if (arc) previous_speed.set(arc_exit_speed);
+  #endif
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
   position = target;  // Update the position
@@ -2676,6 +2870,7 @@ void Planner::buffer_sync_block() {
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
  *  millimeters - the length of the movement, if known
+ *  arc         - an XY arc to step along, if not a line
  *
  * Return 'false' if no segment was queued due to cleaning, cold extrusion, full queue, etc.
  */
@@ -2684,6 +2879,9 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
     , const xyze_float_t &cart_dist_mm
   #endif
   , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    , const arc_plan_t * const arc/*=nullptr*/
+  #endif
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -2755,7 +2953,11 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      #if ENABLED(ARC_PLANNER_BLOCKS)
+        , arc
+      #endif
+    )
   ) return false;
 
   stepper.wake_up();
@@ -2824,6 +3026,65 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
   #endif
 } // buffer_line()
 
+#if ENABLED(ARC_PLANNER_BLOCKS)
+
+  /**
+   * Add an arc in the XY plane to the buffer as one block.
+   * The Stepper ISR steps along its chords, turning the
+   * radius vector by 'theta' for each one.
+   *
+   * Return 'false' if the arc has to be queued as line segments instead.
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const xy_float_t &rvec, const float &theta,
+                           const uint16_t chords, const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters
+  ) {
+    // Leveling bends the arc out of the XY plane
+    if (TERN0(HAS_LEVELING, leveling_active)) return false;
+
+    const float spm_x = settings.axis_steps_per_mm[X_AXIS],
+                radius = rvec.magnitude();
+
+    // The radius vector must fit in Q8 X steps
+    if (radius * spm_x >= float(_BV32(22))) return false;
+
+    arc_plan_t arc;
+    block_arc_t &b = arc.block;
+    b.chords = chords;
+    b.rx = LROUND(rvec.x * spm_x * 256);
+    b.ry = LROUND(rvec.y * spm_x * 256);
+
+    // cos = 1 - 2 sin²(θ/2) keeps its precision for small angles
+    const float sin_half = sin(theta * 0.5f);
+    b.cos_t = int32_t(_BV32(30) - LROUND(2 * sq(sin_half) * float(_BV32(30))));
+    b.sin_t = LROUND(sin(theta) * float(_BV32(30)));
+    b.y_ratio = LROUND(settings.axis_steps_per_mm[Y_AXIS] / spm_x * 65536);
+
+    arc.radius = radius;
+    arc.chord_mm = 2 * radius * ABS(sin_half);
+
+    // Tangents scaled to the arc length, pointing along the rotation
+    const float t = theta * chords;
+    arc.entry.set(-rvec.y * t, rvec.x * t);
+    arc.exit.set((center.y - cart.y) * t, (cart.x - center.x) * t);
+
+    // The tangent is steepest for an axis at the start, at the end, or wherever the
+    // radius vector crosses the other axis. A half turn or more crosses both.
+    const xy_float_t rend = { cart.x - center.x, cart.y - center.y };
+    const float turn = ABS(t), arc_mm = turn * radius;
+    const bool half = turn >= float(M_PI);
+    arc.peak_mm.set(
+      (half || (rvec.x < 0) != (rend.x < 0)) ? arc_mm : turn * _MAX(ABS(rvec.y), ABS(rend.y)),
+      (half || (rvec.y < 0) != (rend.y < 0)) ? arc_mm : turn * _MAX(ABS(rvec.x), ABS(rend.x))
+    );
+
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+    return buffer_segment(machine.a, machine.b, machine.c, machine.e, fr_mm_s, extruder, millimeters, &arc);
+  }
+
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -128,16 +128,49 @@ enum BlockFlag : char {
     uint8_t power;            // Ditto; When in trapezoid mode this is nominal power
     #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
       uint8_t   power_entry;  // Entry power for the laser
-      #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+      #if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+        uint32_t  power_rate; // Power per step rate, with a 24 bit fraction (to avoid a divide in stepper calcs)
+      #else
         uint8_t   power_exit; // Exit power for the laser
         uint32_t  entry_per,  // Steps per power increment (to avoid floats in stepper calcs)
                   exit_per;   // Steps per power decrement
       #endif
     #endif
+    #if ENABLED(LASER_RASTER)
+      uint8_t raster;         // Raster line + 1 to engrave, or 0 for none. 'power' is the full pixel power.
+    #endif
   } block_laser_t;
 
 #endif
 
+#if ENABLED(ARC_PLANNER_BLOCKS)
+
+  /**
+   * An arc in the XY plane, stepped as 'chords' straight chords of
+   * 'chord_events' step events each. The Stepper ISR turns the radius
+   * vector by one chord at a time, all in fixed point.
+   */
+  typedef struct {
+    uint16_t chords;          // Chords in the arc, or 0 for a straight block
+    uint32_t chord_events;    // Step events in each chord
+    int32_t rx, ry,           // Radius vector from the center to the start, in X steps (Q8)
+            cos_t, sin_t,     // Rotation by one chord (Q30)
+            rate_c, rate_e;   // Z and E steps per chord (Q8)
+    uint32_t y_ratio;         // Y steps per X step (Q16)
+    abce_long_t delta;        // Steps from the start to the end of the arc
+  } block_arc_t;
+
+  // An arc on its way into a block, with what the planner needs beyond the block
+  typedef struct {
+    block_arc_t block;
+    float radius,             // (mm) Radius of the arc
+          chord_mm;           // (mm) Length of each chord
+    xy_float_t entry, exit;   // Tangents at the start and end, scaled to the arc length in XY
+    xy_float_t peak_mm;       // (mm) Arc length in XY times the largest X and Y share of the tangent
+  } arc_plan_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -230,6 +263,10 @@ typedef struct block_t {
     block_laser_t laser;
   #endif
 
+  #if ENABLED(ARC_PLANNER_BLOCKS)
+    block_arc_t arc;
+  #endif
+
 } block_t;
 
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
@@ -252,6 +289,9 @@ typedef struct block_t {
      * floating point operations during the move loop.
      */
     uint8_t power;
+    #if ENABLED(LASER_RASTER)
+      uint8_t raster;         // Raster line + 1 for the next block (set by G7)
+    #endif
   } laser_state_t;
 #endif
 
@@ -412,6 +452,25 @@ class Planner {
       }
     #endif
 
+    // Steps to accelerate and to cruise in a trapezoid, calculated with float or integer math
+    static bool trapezoid_steps_float(const block_t * const block, const uint32_t initial_rate, const uint32_t final_rate, uint32_t &accelerate_steps, uint32_t &plateau_steps);
+    #if ENABLED(FIXED_POINT_TRAPEZOIDS)
+      static bool trapezoid_steps_fixed(const block_t * const block, const uint32_t initial_rate, const uint32_t final_rate, uint32_t &accelerate_steps, uint32_t &plateau_steps);
+    #endif
+
+    #if ENABLED(STEPPER_ISR_PROFILING)
+      // Work done by recalculate() for the blocks added while profiling
+      typedef struct {
+        uint32_t calls,       // Blocks planned
+                 reverse,     // Reverse pass kernel runs
+                 forward,     // Forward pass kernel runs
+                 trapezoids,  // Trapezoids calculated
+                 micros;      // Time spent in recalculate()
+      } replan_profile_t;
+      static replan_profile_t replan_profile;
+      static void report_replan_profile();
+    #endif
+
   private:
 
     /**
@@ -662,6 +721,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - an XY arc to step along, if not a line
      *
      * Returns true if movement was buffered, false otherwise
      */
@@ -673,6 +733,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_PLANNER_BLOCKS)
+        , const arc_plan_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -684,6 +747,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - an XY arc to step along, if not a line
      *
      * Returns true is movement is acceptable, false otherwise
      */
@@ -696,6 +760,9 @@ class Planner {
         , const xyze_float_t &cart_dist_mm
       #endif
       , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_PLANNER_BLOCKS)
+        , const arc_plan_t * const arc=nullptr
+      #endif
     );
 
     /**
@@ -722,12 +789,16 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - an XY arc to step along, if not a line
      */
     static bool buffer_segment(const float &a, const float &b, const float &c, const float &e
       #if HAS_DIST_MM_ARG
         , const xyze_float_t &cart_dist_mm
       #endif
       , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      #if ENABLED(ARC_PLANNER_BLOCKS)
+        , const arc_plan_t * const arc=nullptr
+      #endif
     );
 
     FORCE_INLINE static bool buffer_segment(abce_pos_t &abce
@@ -774,6 +845,25 @@ class Planner {
       );
     }
 
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      /**
+       * Add an arc in the XY plane to the buffer as one block.
+       *
+       *  cart        - target position in mm
+       *  center      - center of the arc
+       *  rvec        - radius vector from the center to the start
+       *  theta       - angle of each chord, positive for CCW
+       *  chords      - number of chords stepped along the arc
+       *  fr_mm_s     - (target) speed of the move (mm/s)
+       *  extruder    - target extruder
+       *  millimeters - the length of the arc
+       *
+       * Return 'false' if the arc has to be queued as line segments instead.
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const xy_float_t &rvec, const float &theta,
+                             const uint16_t chords, const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters);
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V82"
+#define EEPROM_VERSION "V83"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -103,6 +103,10 @@
   #include "../feature/backlash.h"
 #endif
 
+#if HAS_SHAPING
+  void M593_report(const AxisEnum axis);
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "../feature/runout.h"
   #ifndef FIL_RUNOUT_ENABLED_DEFAULT
@@ -451,6 +455,16 @@ typedef struct SettingsDataStruct {
              ethernet_subnet;                           // M554 P
   #endif
 
+  //
+  // INPUT_SHAPING
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    shaping_params_t shaping_x;                         // M593 X F D T
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    shaping_params_t shaping_y;                         // M593 Y F D T
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -1422,6 +1436,18 @@ void MarlinSettings::postprocess() {
     }
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if ENABLED(INPUT_SHAPING_X)
+      _FIELD_TEST(shaping_x);
+      EEPROM_WRITE(stepper.get_shaping(X_AXIS));
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      _FIELD_TEST(shaping_y);
+      EEPROM_WRITE(stepper.get_shaping(Y_AXIS));
+    #endif
+
     //
     // Report final CRC and Data Size
     //
@@ -1824,6 +1850,10 @@ void MarlinSettings::postprocess() {
       {
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(thermalManager.user_thermistor);
+        #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+          // Lookup tables aren't stored, so have them rebuilt
+          if (!validating) LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true;
+        #endif
       }
       #endif
 
@@ -2293,6 +2323,29 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ethernet_subnet);  ethernet.subnet  = ethernet_subnet;
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if HAS_SHAPING
+        if (!validating) planner.synchronize(); // Echoes in progress would be lost
+      #endif
+      #if ENABLED(INPUT_SHAPING_X)
+      {
+        shaping_params_t shaping_x;
+        _FIELD_TEST(shaping_x);
+        EEPROM_READ(shaping_x);
+        if (!validating) stepper.set_shaping(X_AXIS, shaping_x);
+      }
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+      {
+        shaping_params_t shaping_y;
+        _FIELD_TEST(shaping_y);
+        EEPROM_READ(shaping_y);
+        if (!validating) stepper.set_shaping(Y_AXIS, shaping_y);
+      }
+      #endif
+
       //
       // Validate Final Size and CRC
       //
@@ -2591,6 +2644,20 @@ void MarlinSettings::reset() {
     #endif
   #endif
 
+  #if HAS_SHAPING
+    planner.synchronize(); // Echoes in progress would be lost
+  #endif
+  #if CORE_IS_XY && HAS_SHAPING
+    // Both motors share the shapers (Checked here, where the shaper types are known)
+    static_assert((SHAPING_TYPE_X) == (SHAPING_TYPE_Y), "COREXY/COREYX input shaping requires the same SHAPING_TYPE on X and Y.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.set_shaping(X_AXIS, { SHAPING_FREQ_X, SHAPING_ZETA_X, SHAPING_TYPE_X });
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.set_shaping(Y_AXIS, { SHAPING_FREQ_Y, SHAPING_ZETA_Y, SHAPING_TYPE_Y });
+  #endif
+
   TERN_(EXTENSIBLE_UI, ExtUI::onFactoryReset());
 
   //
@@ -3829,6 +3896,16 @@ void MarlinSettings::reset() {
       );
     #endif
 
+    #if HAS_SHAPING
+      CONFIG_ECHO_HEADING("Input Shaping:");
+      #if ENABLED(INPUT_SHAPING_X)
+        CONFIG_ECHO_START(); SERIAL_ECHO_SP(2); M593_report(X_AXIS);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        CONFIG_ECHO_START(); SERIAL_ECHO_SP(2); M593_report(Y_AXIS);
+      #endif
+    #endif
+
     #if HAS_FILAMENT_SENSOR
       CONFIG_ECHO_HEADING("Filament runout sensor:");
       CONFIG_ECHO_START();
@@ -132,6 +132,10 @@ Stepper stepper; // Singleton
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(LASER_RASTER)
+  #include "../feature/laser_raster.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -227,10 +231,61 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if HAS_SHAPING
+  uint32_t Stepper::nextShapingISR = SHAPING_NEVER,
+           Stepper::shaping_time; // = 0
+  bool Stepper::shaping_suspended; // = false
+  #if ENABLED(INPUT_SHAPING_X)
+    AxisShaper Stepper::shaping_X;
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    AxisShaper Stepper::shaping_Y;
+  #endif
+#endif
+
+#if ENABLED(STEP_EVENT_SCHEDULE)
+  step_event_t Stepper::step_schedule[STEP_SCHEDULE_SIZE];
+  uint8_t Stepper::schedule_head, // = 0
+          Stepper::schedule_count; // = 0
+  uint32_t Stepper::schedule_ticks, // = 0
+           Stepper::schedule_wait, // = 0
+           Stepper::schedule_interval; // = 0
+  uint8_t Stepper::burst_left; // = 0
+  hal_timer_t Stepper::burst_each, // = 0
+              Stepper::burst_final; // = 0
+  #if ENABLED(LIN_ADVANCE)
+    uint8_t Stepper::burst_phase, // = 0
+            Stepper::schedule_phase; // = 0
+  #endif
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(ARC_PLANNER_BLOCKS)
+  uint16_t Stepper::arc_chord;
+  uint32_t Stepper::arc_chord_events,
+           Stepper::arc_chord_left; // = 0
+  xy_long_t Stepper::arc_r;
+  abce_long_t Stepper::arc_pos;
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #ifndef HAL_PROFILE_TICKS
+    #define HAL_PROFILE_TICKS() HAL_timer_get_count(STEP_TIMER_NUM)
+  #endif
+  #define PROFILE_ISR_PHASE(P, V...) do{ \
+    const hal_timer_t _t0 = HAL_PROFILE_TICKS(); \
+    V; \
+    profile_##P.add(hal_timer_t(HAL_PROFILE_TICKS() - _t0)); \
+  }while(0)
+  isr_phase_profile_t Stepper::profile_pulse, Stepper::profile_block, Stepper::profile_advance;
+  uint32_t Stepper::profile_step_events;
+#else
+  #define PROFILE_ISR_PHASE(P, V...) V
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -254,6 +309,10 @@ xyze_int8_t Stepper::count_direction{0};
   };
 #endif
 
+#if ENABLED(LASER_RASTER)
+  Stepper::stepper_raster_t Stepper::raster; // = { nullptr }
+#endif
+
 #define DUAL_ENDSTOP_APPLY_STEP(A,V)                                                                                        \
   if (separate_multi_axis) {                                                                                                \
     if (A##_HOME_DIR < 0) {                                                                                                 \
@@ -468,11 +527,27 @@ void Stepper::set_directions() {
       count_direction[_AXIS(A)] = 1;            \
     }
 
+  // A shaped motor follows its echoes, so it sets its own direction
+  #define SET_SHAPED_DIR(A)                     \
+    if (shaping_##A.enabled)                    \
+      count_direction[_AXIS(A)] = motor_direction(_AXIS(A)) ? -1 : 1; \
+    else {                                      \
+      SET_STEP_DIR(A);                          \
+    }
+
   #if HAS_X_DIR
-    SET_STEP_DIR(X); // A
+    #if ENABLED(INPUT_SHAPING_X)
+      SET_SHAPED_DIR(X); // A
+    #else
+      SET_STEP_DIR(X); // A
+    #endif
   #endif
   #if HAS_Y_DIR
-    SET_STEP_DIR(Y); // B
+    #if ENABLED(INPUT_SHAPING_Y)
+      SET_SHAPED_DIR(Y); // B
+    #else
+      SET_STEP_DIR(Y); // B
+    #endif
   #endif
   #if HAS_Z_DIR
     SET_STEP_DIR(Z); // C
@@ -1378,10 +1453,10 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    if (!nextMainISR) PROFILE_ISR_PHASE(pulse, pulse_phase_isr());  // 0 = Do coordinated axes Stepper pulses
 
     #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
+      if (!nextAdvanceISR) PROFILE_ISR_PHASE(advance, nextAdvanceISR = advance_isr()); // 0 = Do Linear Advance E Stepper pulses
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -1389,9 +1464,13 @@ void Stepper::isr() {
       if (is_babystep) nextBabystepISR = babystepping_isr();
     #endif
 
+    #if HAS_SHAPING
+      if (!nextShapingISR) shaping_isr();                           // 0 = Do Input Shaping echo pulses
+    #endif
+
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) PROFILE_ISR_PHASE(block, nextMainISR = block_phase_isr()); // Manage acc/deceleration, get next block
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1401,6 +1480,19 @@ void Stepper::isr() {
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
     #endif
 
+    #if HAS_SHAPING
+      // Time until the next echo of any shaped axis
+      nextShapingISR = _MIN(
+        SHAPING_NEVER
+        #if ENABLED(INPUT_SHAPING_X)
+          , shaping_X.enabled ? shaping_X.next_echo(shaping_time) : SHAPING_NEVER
+        #endif
+        #if ENABLED(INPUT_SHAPING_Y)
+          , shaping_Y.enabled ? shaping_Y.next_echo(shaping_time) : SHAPING_NEVER
+        #endif
+      );
+    #endif
+
     // Get the interval to the next ISR call
     const uint32_t interval = _MIN(
       nextMainISR                                       // Time until the next Pulse / Block phase
@@ -1410,6 +1502,9 @@ void Stepper::isr() {
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if HAS_SHAPING
+        , nextShapingISR                                // Come back early for Input Shaping?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1430,6 +1525,11 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if HAS_SHAPING
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_time += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1522,17 +1622,30 @@ void Stepper::pulse_phase_isr() {
   if (abort_current_block) {
     abort_current_block = false;
     if (current_block) discard_current_block();
+    TERN_(STEP_EVENT_SCHEDULE, schedule_count = burst_left = schedule_ticks = schedule_wait = 0);
   }
 
   // If there is no current block, do nothing
   if (!current_block) return;
 
-  // Count of pending loops and events for this iteration
-  const uint32_t pending_events = step_event_count - step_events_completed;
-  uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
+  #if ENABLED(STEP_EVENT_SCHEDULE)
 
-  // Just update the value we will get at the end of the loop
-  step_events_completed += events_to_do;
+    // Nothing precomputed yet?
+    if (!schedule_count) return;
+
+    // Replay events in this ISR until the next one is far enough away
+    #define REPLAY_MORE() (schedule_count && schedule_wait < MIN_SCHEDULE_EVENT_TICKS)
+
+  #else
+
+    // Count of pending loops and events for this iteration
+    const uint32_t pending_events = step_event_count - step_events_completed;
+    uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
+
+    // Just update the value we will get at the end of the loop
+    step_events_completed += events_to_do;
+
+  #endif
 
   // Take multiple steps per interrupt (For high speed moves)
   #if ISR_MULTI_STEPS
@@ -1555,6 +1668,24 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
+    // Let the shaper decide on the step and its direction
+    #define SHAPED_STEP(AXIS, S) do{ \
+      const int8_t _step = S; \
+      step_needed[_AXIS(AXIS)] = _step; \
+      if (_step && (_step > 0) != shaping_##AXIS.forward) { \
+        shaping_##AXIS.forward = _step > 0; \
+        DIR_WAIT_BEFORE(); \
+        AXIS##_APPLY_DIR(shaping_##AXIS.forward != INVERT_##AXIS##_DIR, false); \
+        DIR_WAIT_AFTER(); \
+      } \
+    }while(0)
+
+    // Store a commanded step for shaping
+    #define PULSE_PREP_SHAPING(AXIS) do{ \
+      if (shaping_##AXIS.enabled && step_needed[_AXIS(AXIS)]) \
+        SHAPED_STEP(AXIS, shaping_##AXIS.push(shaping_time, count_direction[_AXIS(AXIS)] > 0)); \
+    }while(0)
+
     // Start an active pulse if needed
     #define PULSE_START(AXIS) do{ \
       if (step_needed[_AXIS(AXIS)]) { \
@@ -1679,31 +1810,86 @@ void Stepper::pulse_phase_isr() {
     #endif // DIRECT_STEPPING
 
     if (!is_page) {
-      // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
-      #endif
-      #if HAS_Z_STEP
-        PULSE_PREP(Z);
-      #endif
+      #if ENABLED(STEP_EVENT_SCHEDULE)
+
+        // Take the steps of the next precomputed event
+        const step_event_t &event = step_schedule[schedule_head];
+        schedule_head = (schedule_head + 1) & (STEP_SCHEDULE_SIZE - 1);
+        schedule_count--;
+        schedule_ticks -= event.ticks;
+        schedule_wait += event.ticks;
+
+        #define REPLAY_PREP(AXIS) do{ \
+          step_needed[_AXIS(AXIS)] = TEST(event.bits, _AXIS(AXIS)); \
+          if (step_needed[_AXIS(AXIS)]) \
+            count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        }while(0)
+
+        #if HAS_X_STEP
+          REPLAY_PREP(X);
+          TERN_(INPUT_SHAPING_X, PULSE_PREP_SHAPING(X));
+        #endif
+        #if HAS_Y_STEP
+          REPLAY_PREP(Y);
+          TERN_(INPUT_SHAPING_Y, PULSE_PREP_SHAPING(Y));
+        #endif
+        #if HAS_Z_STEP
+          REPLAY_PREP(Z);
+        #endif
 
-      #if EITHER(LIN_ADVANCE, MIXING_EXTRUDER)
-        delta_error.e += advance_dividend.e;
-        if (delta_error.e >= 0) {
-          count_position.e += count_direction.e;
-          #if ENABLED(LIN_ADVANCE)
-            delta_error.e -= advance_divisor;
+        #if ENABLED(LIN_ADVANCE)
+          if (TEST(event.bits, E_AXIS)) {
+            count_position.e += count_direction.e;
             // Don't step E here - But remember the number of steps to perform
             motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
-          #else
-            step_needed.e = true;
-          #endif
-        }
-      #elif HAS_E0_STEP
-        PULSE_PREP(E);
+          }
+
+          // Wake the advance ISR as trapezoid_interval() does, but when the event is due
+          const bool decel = TEST(event.bits, SCHEDULE_BIT_LA_DECEL);
+          if (LA_use_advance_lead) {
+            if ((decel && !TEST(schedule_phase, SCHEDULE_BIT_LA_DECEL)) || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
+              initiateLA();
+              if (decel) LA_isr_rate = current_block->advance_speed;
+            }
+          }
+          else if (LA_steps) initiateLA();
+          schedule_phase = event.bits & SCHEDULE_LA_PHASE;
+
+        #elif HAS_E0_STEP
+          REPLAY_PREP(E);
+        #endif
+
+      #else
+
+        // Determine if pulses are needed
+        #if HAS_X_STEP
+          PULSE_PREP(X);
+          TERN_(INPUT_SHAPING_X, PULSE_PREP_SHAPING(X));
+        #endif
+        #if HAS_Y_STEP
+          PULSE_PREP(Y);
+          TERN_(INPUT_SHAPING_Y, PULSE_PREP_SHAPING(Y));
+        #endif
+        #if HAS_Z_STEP
+          PULSE_PREP(Z);
+        #endif
+
+        #if EITHER(LIN_ADVANCE, MIXING_EXTRUDER)
+          delta_error.e += advance_dividend.e;
+          if (delta_error.e >= 0) {
+            count_position.e += count_direction.e;
+            #if ENABLED(LIN_ADVANCE)
+              delta_error.e -= advance_divisor;
+              // Don't step E here - But remember the number of steps to perform
+              motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
+            #else
+              step_needed.e = true;
+            #endif
+          }
+        #elif HAS_E0_STEP
+          PULSE_PREP(E);
+        #endif
+
       #endif
     }
 
@@ -1765,13 +1951,246 @@ void Stepper::pulse_phase_isr() {
       #endif
     #endif
 
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      // Go on to the next arc chord within the burst. After the burst, block_phase_isr() does it.
+      if (arc_chord_left && !--arc_chord_left && events_to_do > 1) next_arc_chord();
+    #endif
+
     #if ISR_MULTI_STEPS
-      if (events_to_do) START_LOW_PULSE();
+      if (TERN(STEP_EVENT_SCHEDULE, REPLAY_MORE(), events_to_do)) START_LOW_PULSE();
+    #endif
+
+  } while (TERN(STEP_EVENT_SCHEDULE, REPLAY_MORE(), --events_to_do));
+}
+
+/**
+ * Update the speed of the current block after a burst of step events, following
+ * its acceleration, cruise and deceleration, along with Linear Advance and the
+ * laser power. Also sets steps_per_isr for the next burst.
+ * With STEP_EVENT_SCHEDULE the replayed events update Linear Advance instead.
+ */
+uint32_t Stepper::trapezoid_interval() {
+  uint32_t interval;
+
+  // Are we in acceleration phase ?
+  if (step_events_completed <= accelerate_until) { // Calculate new timer value
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Get the next speed to use (Jerk limited!)
+      uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
+                               ? _eval_bezier_curve(acceleration_time)
+                               : current_block->cruise_rate;
+    #else
+      acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
+      NOMORE(acc_step_rate, current_block->nominal_rate);
+    #endif
+
+    // acc_step_rate is in steps/second
+
+    // step_rate to timer interval and steps per stepper isr
+    interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
+    acceleration_time += interval;
+
+    #if ENABLED(LIN_ADVANCE) && DISABLED(STEP_EVENT_SCHEDULE)
+      if (LA_use_advance_lead) {
+        // Fire ISR if final adv_rate is reached
+        if (LA_steps && LA_isr_rate != current_block->advance_speed) nextAdvanceISR = 0;
+      }
+      else if (LA_steps) nextAdvanceISR = 0;
+    #endif
+
+    // Update laser - Accelerating
+    #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+      if (laser_trap.enabled) {
+        #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+          if (current_block->laser.entry_per) {
+            laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
+            laser_trap.last_step_count = step_events_completed;
+
+            // Should be faster than a divide, since this should trip just once
+            if (laser_trap.acc_step_count < 0) {
+              while (laser_trap.acc_step_count < 0) {
+                laser_trap.acc_step_count += current_block->laser.entry_per;
+                if (laser_trap.cur_power < current_block->laser.power) laser_trap.cur_power++;
+              }
+              cutter.set_ocr_power(laser_trap.cur_power);
+            }
+          }
+        #else
+          laser_trap_rate_power(acc_step_rate);
+        #endif
+      }
+    #endif
+  }
+  // Are we in Deceleration phase ?
+  else if (step_events_completed > decelerate_after) {
+    uint32_t step_rate;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // If this is the 1st time we process the 2nd half of the trapezoid...
+      if (!bezier_2nd_half) {
+        // Initialize the Bézier speed curve
+        _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+        bezier_2nd_half = true;
+        // The first point starts at cruise rate. Just save evaluation of the Bézier curve
+        step_rate = current_block->cruise_rate;
+      }
+      else {
+        // Calculate the next speed to use
+        step_rate = deceleration_time < current_block->deceleration_time
+          ? _eval_bezier_curve(deceleration_time)
+          : current_block->final_rate;
+      }
+    #else
+
+      // Using the old trapezoidal control
+      step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
+      if (step_rate < acc_step_rate) { // Still decelerating?
+        step_rate = acc_step_rate - step_rate;
+        NOLESS(step_rate, current_block->final_rate);
+      }
+      else
+        step_rate = current_block->final_rate;
     #endif
 
-  } while (--events_to_do);
+    // step_rate is in steps/second
+
+    // step_rate to timer interval and steps per stepper isr
+    interval = calc_timer_interval(step_rate, &steps_per_isr);
+    deceleration_time += interval;
+
+    #if ENABLED(LIN_ADVANCE) && DISABLED(STEP_EVENT_SCHEDULE)
+      if (LA_use_advance_lead) {
+        // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
+        if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
+          initiateLA();
+          LA_isr_rate = current_block->advance_speed;
+        }
+      }
+      else if (LA_steps) nextAdvanceISR = 0;
+    #endif // LIN_ADVANCE
+
+    // Update laser - Decelerating
+    #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+      if (laser_trap.enabled) {
+        #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+          if (current_block->laser.exit_per) {
+            laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
+            laser_trap.last_step_count = step_events_completed;
+
+            // Should be faster than a divide, since this should trip just once
+            if (laser_trap.acc_step_count < 0) {
+              while (laser_trap.acc_step_count < 0) {
+                laser_trap.acc_step_count += current_block->laser.exit_per;
+                if (laser_trap.cur_power > current_block->laser.power_exit) laser_trap.cur_power--;
+              }
+              cutter.set_ocr_power(laser_trap.cur_power);
+            }
+          }
+        #else
+          laser_trap_rate_power(step_rate);
+        #endif
+      }
+    #endif
+  }
+  // Must be in cruise phase otherwise
+  else {
+
+    #if ENABLED(LIN_ADVANCE) && DISABLED(STEP_EVENT_SCHEDULE)
+      // If there are any esteps, fire the next advance_isr "now"
+      if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
+    #endif
+
+    // Calculate the ticks_nominal for this nominal speed, if not done yet
+    if (ticks_nominal < 0) {
+      // step_rate to timer interval and loops for the nominal speed
+      ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+    }
+
+    // The timer interval is just the nominal value for the nominal speed
+    interval = ticks_nominal;
+
+    // Update laser - Cruising
+    #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+      if (laser_trap.enabled) {
+        if (!laser_trap.cruise_set) {
+          laser_trap.cur_power = current_block->laser.power;
+          cutter.set_ocr_power(laser_trap.cur_power);
+          laser_trap.cruise_set = true;
+        }
+        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+          laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
+        #else
+          laser_trap.last_step_count = step_events_completed;
+        #endif
+      }
+    #endif
+  }
+
+  // Update laser - Next raster pixel
+  #if ENABLED(LASER_RASTER)
+    if (raster.pixels) {
+      // Each pixel spans step_event_count / count step events of the scanline
+      raster.acc += (step_events_completed - raster.events) * raster.count;
+      raster.events = step_events_completed;
+      if (raster.acc >= step_event_count) {
+        do {
+          raster.acc -= step_event_count;
+          raster.index++;
+        } while (raster.acc >= step_event_count);
+        set_raster_power();
+      }
+    }
+  #endif
+
+  return interval;
 }
 
+#if ENABLED(LASER_RASTER)
+
+  // Scale the full power by the current pixel. Off past the end of the line.
+  void Stepper::set_raster_power() {
+    cutter.set_ocr_power(raster.index < raster.count ? uint16_t(raster.pixels[raster.index]) * raster.power / 255 : 0);
+  }
+
+  // The scanline is done. Don't let the last pixel burn on into the next move.
+  void Stepper::finish_raster() {
+    raster.pixels = nullptr;
+    cutter.set_ocr_power(0);
+  }
+
+#endif
+
+#if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+
+  /**
+   * Set the laser power in proportion to the step rate, for the same energy per mm
+   * as the nominal power at the nominal rate. The planner's fixed-point power per
+   * step rate turns this into a single multiply.
+   */
+  void Stepper::laser_trap_rate_power(const uint32_t step_rate) {
+    if (laser_trap.till_update) {
+      laser_trap.till_update--;
+      return;
+    }
+    laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
+
+    // Limit the rate to the nominal rate so the product fits in STEP_MULTIPLY's result,
+    // and clamp the 32-bit product before narrowing it to the 8-bit power
+    const uint8_t power = current_block->laser.power;
+    const uint32_t rate_power = STEP_MULTIPLY(_MIN(step_rate, current_block->nominal_rate), current_block->laser.power_rate);
+    uint8_t trap_power = _MIN(rate_power, uint32_t(power));
+    #ifdef LASER_POWER_INLINE_TRAPEZOID_FLOOR
+      NOLESS(trap_power, _MIN(uint8_t(LASER_POWER_INLINE_TRAPEZOID_FLOOR), power));
+    #endif
+    if (trap_power != laser_trap.cur_power) {
+      laser_trap.cur_power = trap_power;
+      cutter.set_ocr_power(laser_trap.cur_power);
+    }
+  }
+
+#endif
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -1784,6 +2203,12 @@ uint32_t Stepper::block_phase_isr() {
   // If there is a current block
   if (current_block) {
 
+    #if ENABLED(STEP_EVENT_SCHEDULE)
+      // Keep the schedule ahead until all events of the block are replayed
+      if (step_events_completed < step_event_count || burst_left || schedule_count)
+        return fill_step_schedule();
+    #endif
+
     // If current block is finished, reset pointer and finalize state
     if (step_events_completed >= step_event_count) {
       #if ENABLED(DIRECT_STEPPING)
@@ -1806,174 +2231,10 @@ uint32_t Stepper::block_phase_isr() {
       discard_current_block();
     }
     else {
-      // Step events not completed yet...
-
-      // Are we in acceleration phase ?
-      if (step_events_completed <= accelerate_until) { // Calculate new timer value
-
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
-                                   ? _eval_bezier_curve(acceleration_time)
-                                   : current_block->cruise_rate;
-        #else
-          acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
-        #endif
-
-        // acc_step_rate is in steps/second
+      interval = trapezoid_interval();
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
-        acceleration_time += interval;
-
-        #if ENABLED(LIN_ADVANCE)
-          if (LA_use_advance_lead) {
-            // Fire ISR if final adv_rate is reached
-            if (LA_steps && LA_isr_rate != current_block->advance_speed) nextAdvanceISR = 0;
-          }
-          else if (LA_steps) nextAdvanceISR = 0;
-        #endif
-
-        // Update laser - Accelerating
-        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          if (laser_trap.enabled) {
-            #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
-              if (current_block->laser.entry_per) {
-                laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
-                laser_trap.last_step_count = step_events_completed;
-
-                // Should be faster than a divide, since this should trip just once
-                if (laser_trap.acc_step_count < 0) {
-                  while (laser_trap.acc_step_count < 0) {
-                    laser_trap.acc_step_count += current_block->laser.entry_per;
-                    if (laser_trap.cur_power < current_block->laser.power) laser_trap.cur_power++;
-                  }
-                  cutter.set_ocr_power(laser_trap.cur_power);
-                }
-              }
-            #else
-              if (laser_trap.till_update)
-                laser_trap.till_update--;
-              else {
-                laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
-                laser_trap.cur_power = (current_block->laser.power * acc_step_rate) / current_block->nominal_rate;
-                cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency is irrelevant it the last line was many cycles
-              }
-            #endif
-          }
-        #endif
-      }
-      // Are we in Deceleration phase ?
-      else if (step_events_completed > decelerate_after) {
-        uint32_t step_rate;
-
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // If this is the 1st time we process the 2nd half of the trapezoid...
-          if (!bezier_2nd_half) {
-            // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
-            bezier_2nd_half = true;
-            // The first point starts at cruise rate. Just save evaluation of the Bézier curve
-            step_rate = current_block->cruise_rate;
-          }
-          else {
-            // Calculate the next speed to use
-            step_rate = deceleration_time < current_block->deceleration_time
-              ? _eval_bezier_curve(deceleration_time)
-              : current_block->final_rate;
-          }
-        #else
-
-          // Using the old trapezoidal control
-          step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
-          if (step_rate < acc_step_rate) { // Still decelerating?
-            step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
-          }
-          else
-            step_rate = current_block->final_rate;
-        #endif
-
-        // step_rate is in steps/second
-
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(step_rate, &steps_per_isr);
-        deceleration_time += interval;
-
-        #if ENABLED(LIN_ADVANCE)
-          if (LA_use_advance_lead) {
-            // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
-            if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
-              initiateLA();
-              LA_isr_rate = current_block->advance_speed;
-            }
-          }
-          else if (LA_steps) nextAdvanceISR = 0;
-        #endif // LIN_ADVANCE
-
-        // Update laser - Decelerating
-        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          if (laser_trap.enabled) {
-            #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
-              if (current_block->laser.exit_per) {
-                laser_trap.acc_step_count -= step_events_completed - laser_trap.last_step_count;
-                laser_trap.last_step_count = step_events_completed;
-
-                // Should be faster than a divide, since this should trip just once
-                if (laser_trap.acc_step_count < 0) {
-                  while (laser_trap.acc_step_count < 0) {
-                    laser_trap.acc_step_count += current_block->laser.exit_per;
-                    if (laser_trap.cur_power > current_block->laser.power_exit) laser_trap.cur_power--;
-                  }
-                  cutter.set_ocr_power(laser_trap.cur_power);
-                }
-              }
-            #else
-              if (laser_trap.till_update)
-                laser_trap.till_update--;
-              else {
-                laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
-                laser_trap.cur_power = (current_block->laser.power * step_rate) / current_block->nominal_rate;
-                cutter.set_ocr_power(laser_trap.cur_power); // Cycle efficiency isn't relevant when the last line was many cycles
-              }
-            #endif
-          }
-        #endif
-      }
-      // Must be in cruise phase otherwise
-      else {
-
-        #if ENABLED(LIN_ADVANCE)
-          // If there are any esteps, fire the next advance_isr "now"
-          if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
-        #endif
-
-        // Calculate the ticks_nominal for this nominal speed, if not done yet
-        if (ticks_nominal < 0) {
-          // step_rate to timer interval and loops for the nominal speed
-          ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
-        }
-
-        // The timer interval is just the nominal value for the nominal speed
-        interval = ticks_nominal;
-
-        // Update laser - Cruising
-        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          if (laser_trap.enabled) {
-            if (!laser_trap.cruise_set) {
-              laser_trap.cur_power = current_block->laser.power;
-              cutter.set_ocr_power(laser_trap.cur_power);
-              laser_trap.cruise_set = true;
-            }
-            #if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
-              laser_trap.till_update = LASER_POWER_INLINE_TRAPEZOID_CONT_PER;
-            #else
-              laser_trap.last_step_count = step_events_completed;
-            #endif
-          }
-        #endif
-      }
+      // Start the next arc chord if the burst ended with the last one
+      TERN_(ARC_PLANNER_BLOCKS, if (current_block->arc.chords && !arc_chord_left) next_arc_chord());
     }
   }
 
@@ -2111,6 +2372,7 @@ uint32_t Stepper::block_phase_isr() {
 
       // Based on the oversampling factor, do the calculations
       step_event_count = current_block->step_event_count << oversampling;
+      TERN_(STEPPER_ISR_PROFILING, profile_step_events += current_block->step_event_count);
 
       // Initialize Bresenham delta errors to 1/2
       delta_error = -int32_t(step_event_count);
@@ -2146,6 +2408,9 @@ uint32_t Stepper::block_phase_isr() {
           LA_isr_rate = current_block->advance_speed;
         }
         else LA_isr_rate = LA_ADV_NEVER;
+
+        // No events replayed yet. The block starts before its deceleration point.
+        TERN_(STEP_EVENT_SCHEDULE, schedule_phase = decelerate_after ? _BV(SCHEDULE_BIT_LA_ACCEL) : 0);
       #endif
 
       if ( ENABLED(HAS_L64XX)       // Always set direction for L64xx (Also enables the chips)
@@ -2158,10 +2423,17 @@ uint32_t Stepper::block_phase_isr() {
         set_directions(current_block->direction_bits);
       }
 
+      #if ENABLED(ARC_PLANNER_BLOCKS)
+        if (current_block->arc.chords)
+          start_arc();
+        else
+          arc_chord_left = 0;
+      #endif
+
       #if ENABLED(LASER_POWER_INLINE)
         const power_status_t stat = current_block->laser.status;
         #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
-          laser_trap.enabled = stat.isPlanned && stat.isEnabled;
+          laser_trap.enabled = stat.isPlanned && stat.isEnabled && !TERN0(LASER_RASTER, current_block->laser.raster);
           laser_trap.cur_power = current_block->laser.power_entry; // RESET STATE
           laser_trap.cruise_set = false;
           #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
@@ -2187,6 +2459,17 @@ uint32_t Stepper::block_phase_isr() {
             #endif
           }
         #endif
+        #if ENABLED(LASER_RASTER)
+          if (current_block->laser.raster && stat.isEnabled) {
+            const uint8_t line = current_block->laser.raster - 1;
+            raster.pixels = laser_raster.pixels[line];
+            raster.count = laser_raster.length[line];
+            raster.index = 0;
+            raster.events = raster.acc = 0;
+            raster.power = current_block->laser.power;
+            set_raster_power();
+          }
+        #endif
       #endif // LASER_POWER_INLINE
 
       // At this point, we must ensure the movement about to execute isn't
@@ -2220,6 +2503,12 @@ uint32_t Stepper::block_phase_isr() {
 
       // Calculate the initial timer interval
       interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+
+      #if ENABLED(STEP_EVENT_SCHEDULE)
+        // Precompute the first events, spaced like the first interval
+        schedule_interval = interval;
+        interval += fill_step_schedule();
+      #endif
     }
     #if ENABLED(LASER_POWER_INLINE_CONTINUOUS)
       else { // No new block found; so apply inline laser parameters
@@ -2242,6 +2531,156 @@ uint32_t Stepper::block_phase_isr() {
   return interval;
 }
 
+#if ENABLED(ARC_PLANNER_BLOCKS)
+
+  /**
+   * Start stepping the first chord of an arc block
+   */
+  void Stepper::start_arc() {
+    const block_arc_t &arc = current_block->arc;
+    arc_chord_events = arc.chord_events << oversampling_factor;
+    arc_r.set(arc.rx, arc.ry);
+    arc_pos.reset();
+    arc_chord = 0;
+    next_arc_chord();
+  }
+
+  /**
+   * Turn the radius vector by one chord and set up the Bresenham
+   * and the directions for the steps to the end of the chord.
+   * The last chord ends exactly at the end of the block.
+   */
+  void Stepper::next_arc_chord() {
+    const block_arc_t &arc = current_block->arc;
+    abce_long_t end;
+    if (++arc_chord < arc.chords) {
+      const int32_t rx = arc_r.x, ry = arc_r.y;
+      arc_r.x = int32_t((int64_t(rx) * arc.cos_t - int64_t(ry) * arc.sin_t + _BV32(29)) >> 30);
+      arc_r.y = int32_t((int64_t(rx) * arc.sin_t + int64_t(ry) * arc.cos_t + _BV32(29)) >> 30);
+      end.a = (arc_r.x - arc.rx + 128) >> 8;
+      end.b = int32_t((int64_t(arc_r.y - arc.ry) * arc.y_ratio + _BV32(23)) >> 24);
+      end.c = (arc.rate_c * int32_t(arc_chord) + 128) >> 8;
+      end.e = (arc.rate_e * int32_t(arc_chord) + 128) >> 8;
+    }
+    else
+      end = arc.delta;
+
+    const abce_long_t d = end - arc_pos;
+    arc_pos = end;
+
+    // Keep the direction of any axis that doesn't step in this chord
+    uint8_t dm = last_direction_bits;
+    #define ARC_AXIS_DIR(AXIS, D) do{ \
+      if (D < 0) SBI(dm, AXIS); else if (D > 0) CBI(dm, AXIS); \
+    }while(0)
+    ARC_AXIS_DIR(A_AXIS, d.a);
+    ARC_AXIS_DIR(B_AXIS, d.b);
+    ARC_AXIS_DIR(C_AXIS, d.c);
+    ARC_AXIS_DIR(E_AXIS, d.e);
+    if (dm != last_direction_bits) set_directions(dm);
+
+    advance_dividend.set(uint32_t(ABS(d.a)) << 1, uint32_t(ABS(d.b)) << 1, uint32_t(ABS(d.c)) << 1, uint32_t(ABS(d.e)) << 1);
+    advance_divisor = arc_chord_events << 1;
+    delta_error = -int32_t(arc_chord_events);
+    arc_chord_left = arc_chord_events;
+  }
+
+#endif // ARC_PLANNER_BLOCKS
+
+#if ENABLED(STEP_EVENT_SCHEDULE)
+
+  /**
+   * Run the Bresenham and the speed updates of the current block ahead of the
+   * step pulses, up to STEP_SCHEDULE_HORIZON. The step events of each burst are
+   * spread evenly over its interval and events with no steps are merged into
+   * the one before, so pulse_phase_isr only has to replay the schedule.
+   * Each call computes at most STEP_SCHEDULE_CHUNK events with steps, so no
+   * single ISR runs long, as at a block change. Events with no steps, as on slow
+   * moves where oversampling makes many of them, don't count against the chunk.
+   * A burst that doesn't fit in the schedule is continued on the next call.
+   */
+  uint32_t Stepper::fill_step_schedule() {
+    constexpr uint32_t horizon_ticks = uint32_t(STEP_SCHEDULE_HORIZON) * (STEPPER_TIMER_TICKS_PER_US);
+
+    for (uint8_t steps_left = STEP_SCHEDULE_CHUNK; steps_left
+      && schedule_count < (STEP_SCHEDULE_SIZE)
+      && schedule_ticks < horizon_ticks;
+    ) {
+      if (!burst_left) {
+        if (step_events_completed >= step_event_count) break;
+
+        // Start the next burst
+        burst_left = _MIN(step_event_count - step_events_completed, steps_per_isr);
+        step_events_completed += burst_left;
+
+        // The speed is updated after each burst, except the last. The last event
+        // of the block waits for the first interval of the next block instead.
+        const bool done = step_events_completed >= step_event_count;
+        if (!done) schedule_interval = trapezoid_interval();
+        burst_each = schedule_interval / burst_left;
+        burst_final = done ? 0 : schedule_interval - burst_each * (burst_left - 1);
+
+        #if ENABLED(LIN_ADVANCE)
+          burst_phase = step_events_completed > decelerate_after ? _BV(SCHEDULE_BIT_LA_DECEL)
+                      : step_events_completed < decelerate_after ? _BV(SCHEDULE_BIT_LA_ACCEL)
+                      : 0;
+        #endif
+      }
+
+      // Find the axes to step for the next event of the burst
+      uint8_t bits = 0;
+      #define SCHEDULE_PREP(AXIS) do{ \
+        delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+        if (delta_error[_AXIS(AXIS)] >= 0) { \
+          delta_error[_AXIS(AXIS)] -= advance_divisor; \
+          SBI(bits, _AXIS(AXIS)); \
+        } \
+      }while(0)
+      #if HAS_X_STEP
+        SCHEDULE_PREP(X);
+      #endif
+      #if HAS_Y_STEP
+        SCHEDULE_PREP(Y);
+      #endif
+      #if HAS_Z_STEP
+        SCHEDULE_PREP(Z);
+      #endif
+      #if ENABLED(LIN_ADVANCE) || HAS_E0_STEP
+        SCHEDULE_PREP(E);
+      #endif
+      if (bits) --steps_left;
+
+      --burst_left;
+      push_step_event(bits | TERN0(LIN_ADVANCE, burst_phase), burst_left ? burst_each : burst_final);
+    }
+
+    const uint32_t wait = schedule_wait;
+    schedule_wait = 0;
+    return wait;
+  }
+
+  void Stepper::push_step_event(const uint8_t bits, const hal_timer_t ticks) {
+    step_event_t * const last = schedule_count ? &step_schedule[(schedule_head + schedule_count - 1) & (STEP_SCHEDULE_SIZE - 1)] : nullptr;
+
+    // An event with no steps just adds to the wait after the previous one,
+    // unless it starts a new Linear Advance phase
+    if (bits == TERN0(LIN_ADVANCE, ((last ? last->bits : schedule_phase) & SCHEDULE_LA_PHASE))) {
+      if (!last) { schedule_wait += ticks; return; }
+      if (last->ticks <= hal_timer_t(HAL_TIMER_TYPE_MAX) - ticks) {
+        last->ticks += ticks;
+        schedule_ticks += ticks;
+        return;
+      }
+    }
+    step_event_t &event = step_schedule[(schedule_head + schedule_count) & (STEP_SCHEDULE_SIZE - 1)];
+    event.bits = bits;
+    event.ticks = ticks;
+    schedule_count++;
+    schedule_ticks += ticks;
+  }
+
+#endif // STEP_EVENT_SCHEDULE
+
 #if ENABLED(LIN_ADVANCE)
 
   // Timer interrupt for E. LA_steps is set in the main routine
@@ -2249,12 +2688,20 @@ uint32_t Stepper::block_phase_isr() {
     uint32_t interval;
 
     if (LA_use_advance_lead) {
-      if (step_events_completed > decelerate_after && LA_current_adv_steps > LA_final_adv_steps) {
+      #if ENABLED(STEP_EVENT_SCHEDULE)
+        // Follow the replayed events, not the schedule computed ahead of them
+        const bool decel = TEST(schedule_phase, SCHEDULE_BIT_LA_DECEL),
+                   accel = TEST(schedule_phase, SCHEDULE_BIT_LA_ACCEL);
+      #else
+        const bool decel = step_events_completed > decelerate_after,
+                   accel = step_events_completed < decelerate_after;
+      #endif
+      if (decel && LA_current_adv_steps > LA_final_adv_steps) {
         LA_steps--;
         LA_current_adv_steps--;
         interval = LA_isr_rate;
       }
-      else if (step_events_completed < decelerate_after && LA_current_adv_steps < LA_max_adv_steps) {
+      else if (accel && LA_current_adv_steps < LA_max_adv_steps) {
              //step_events_completed <= (uint32_t)accelerate_until) {
         LA_steps++;
         LA_current_adv_steps++;
@@ -2347,6 +2794,239 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif
 
+#if HAS_SHAPING
+
+  /**
+   * Work out the impulses of a shaper. A frequency of 0 leaves a single
+   * impulse, for no shaping. Return 'false' if the settings are out of range,
+   * or the echoes would come too late for the step buffer.
+   */
+  bool AxisShaper::set(const shaping_params_t &p) {
+    if (p.type > SHAPER_MZV) return false;
+
+    float amp[SHAPING_MAX_IMPULSES] = { 1 }, at[SHAPING_MAX_IMPULSES] = { 0 };
+    uint8_t n = 1;
+    float td = 0;
+
+    if (p.frequency) {
+      if (p.frequency < (SHAPING_MIN_FREQ) || !WITHIN(p.zeta, 0, 0.99f)) return false;
+      const float df = SQRT(1 - sq(p.zeta));  // Damped / natural frequency
+      td = 1 / (p.frequency * df);             // Damped period
+      switch (p.type) {
+        case SHAPER_ZV: {
+          const float K = exp(-p.zeta * float(M_PI) / df);
+          n = 2; amp[1] = K; at[1] = 0.5f;
+        } break;
+        case SHAPER_ZVD: {
+          const float K = exp(-p.zeta * float(M_PI) / df);
+          n = 3; amp[1] = 2 * K; amp[2] = sq(K); at[1] = 0.5f; at[2] = 1;
+        } break;
+        case SHAPER_MZV: {
+          const float K = exp(-0.75f * p.zeta * float(M_PI) / df), a1 = 1 - float(M_SQRT1_2);
+          n = 3; amp[0] = a1; amp[1] = (float(M_SQRT2) - 1) * K; amp[2] = a1 * sq(K); at[1] = 0.375f; at[2] = 0.75f;
+        } break;
+      }
+      if (at[n - 1] * td * (STEPPER_TIMER_RATE) > SHAPING_MAX_DELAY) return false;
+    }
+
+    float total = 0;
+    LOOP_L_N(i, n) total += amp[i];
+
+    // The first impulse takes the rounding, so the parts make a whole step
+    int16_t rest = SHAPING_STEP;
+    for (uint8_t i = n; --i;) {
+      amplitude[i] = LROUND(amp[i] / total * (SHAPING_STEP));
+      delay[i] = LROUND(at[i] * td * (STEPPER_TIMER_RATE));
+      rest -= amplitude[i];
+    }
+    amplitude[0] = rest;
+    delay[0] = 0;
+
+    params = p;
+    impulses = n;
+    reset();
+    return true;
+  }
+
+  /**
+   * Time until the next echo is due, in stepper timer ticks.
+   * Zero if an echo or a step is due now.
+   */
+  uint32_t AxisShaper::next_echo(const uint32_t now) const {
+    if (error >= SHAPING_THRESHOLD || error <= -SHAPING_THRESHOLD) return 0;
+    uint32_t next = SHAPING_NEVER;
+    LOOP_S_L_N(k, 1, impulses) {
+      const uint16_t p = peek[k];
+      if (p == (k == 1 ? head : peek[k - 1])) continue; // Caught up with the steps or the previous impulse
+      const int32_t wait = int32_t((times[p] & ~1UL) + delay[k] - now);
+      if (wait <= 0) return 0;
+      NOMORE(next, uint32_t(wait));
+    }
+    return next;
+  }
+
+  /**
+   * Apply one echo that is due, or take a step that is owed.
+   * Return 'false' if there was nothing to do.
+   */
+  bool AxisShaper::echo(const uint32_t now, int8_t &step) {
+    if (error >= SHAPING_THRESHOLD || error <= -SHAPING_THRESHOLD) { step = add(0); return true; }
+    LOOP_S_L_N(k, 1, impulses) {
+      const uint16_t p = peek[k];
+      if (p == (k == 1 ? head : peek[k - 1])) continue;
+      const uint32_t t = times[p];
+      if (int32_t((t & ~1UL) + delay[k] - now) > 0) continue;
+      peek[k] = p + 1 == SHAPING_BUFFER_SIZE ? 0 : p + 1;
+      step = add(TEST(t, 0) ? amplitude[k] : -amplitude[k]);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * The buffer is full, so apply the rest of the oldest step now.
+   * This only happens above SHAPING_MAX_STEPRATE.
+   */
+  void AxisShaper::flush_oldest() {
+    const uint16_t tail = peek[impulses - 1],
+                   next = tail + 1 == SHAPING_BUFFER_SIZE ? 0 : tail + 1;
+    const int16_t sign = TEST(times[tail], 0) ? 1 : -1;
+    LOOP_S_L_N(k, 1, impulses) if (peek[k] == tail) {
+      error += sign * amplitude[k];
+      peek[k] = next;
+    }
+  }
+
+  /**
+   * Input Shaping ISR phase
+   *
+   * Step the shaped axes for the echoes that are due. Echoes that
+   * come due together are stepped with normal pulse timing between
+   * them, up to the steps per ISR of the current block.
+   */
+  void Stepper::shaping_isr() {
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      START_LOW_PULSE(); // Leave room after a step from the pulse phase
+    #endif
+
+    xyze_bool_t step_needed{0};
+
+    #define SHAPING_ECHO(AXIS) do{ \
+      int8_t _echo_step; \
+      if (shaping_##AXIS.enabled && shaping_##AXIS.echo(shaping_time, _echo_step)) { \
+        due = true; \
+        SHAPED_STEP(AXIS, _echo_step); \
+      } \
+      else \
+        step_needed[_AXIS(AXIS)] = false; \
+    }while(0)
+
+    for (uint8_t i = steps_per_isr;;) {
+      bool due = false;
+      TERN_(INPUT_SHAPING_X, SHAPING_ECHO(X));
+      TERN_(INPUT_SHAPING_Y, SHAPING_ECHO(Y));
+      if (!due) break;
+
+      if (TERN0(INPUT_SHAPING_X, step_needed.x) || TERN0(INPUT_SHAPING_Y, step_needed.y)) {
+        #if ISR_PULSE_CONTROL
+          AWAIT_LOW_PULSE();
+        #endif
+
+        TERN_(INPUT_SHAPING_X, PULSE_START(X));
+        TERN_(INPUT_SHAPING_Y, PULSE_START(Y));
+
+        TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+
+        #if ISR_PULSE_CONTROL
+          START_HIGH_PULSE();
+          AWAIT_HIGH_PULSE();
+        #endif
+
+        TERN_(INPUT_SHAPING_X, PULSE_STOP(X));
+        TERN_(INPUT_SHAPING_Y, PULSE_STOP(Y));
+
+        #if ISR_PULSE_CONTROL
+          START_LOW_PULSE();
+        #endif
+      }
+
+      if (!--i) break;
+    }
+  }
+
+  AxisShaper& Stepper::shaper(const AxisEnum axis) {
+    #if BOTH(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+      return axis == Y_AXIS ? shaping_Y : shaping_X;
+    #else
+      UNUSED(axis);
+      return TERN(INPUT_SHAPING_X, shaping_X, shaping_Y);
+    #endif
+  }
+
+  /**
+   * Start the shapers with empty buffers. Shaped motors take over their
+   * direction pins from set_directions(), so set them first. Call this
+   * only when no echoes are left, or they are lost.
+   */
+  void Stepper::restart_shaping() {
+    #define _RESTART_SHAPING(A) do{ \
+      shaping_##A.reset(); \
+      shaping_##A.enabled = false; \
+    }while(0)
+    #define _ENABLE_SHAPING(A) do{ \
+      shaping_##A.enabled = !shaping_suspended && shaping_##A.impulses > 1; \
+      shaping_##A.forward = !motor_direction(_AXIS(A)); \
+    }while(0)
+
+    TERN_(INPUT_SHAPING_X, _RESTART_SHAPING(X));
+    TERN_(INPUT_SHAPING_Y, _RESTART_SHAPING(Y));
+    set_directions();
+    TERN_(INPUT_SHAPING_X, _ENABLE_SHAPING(X));
+    TERN_(INPUT_SHAPING_Y, _ENABLE_SHAPING(Y));
+  }
+
+  bool Stepper::set_shaping(const AxisEnum axis, const shaping_params_t &params) {
+    #if CORE_IS_XY
+      // Both motors move X and Y. The same shaper on both is the same shaper on X and Y.
+      UNUSED(axis);
+      AxisShaper * const shapers[] = { &shaping_X, &shaping_Y };
+    #else
+      AxisShaper * const shapers[] = { &shaper(axis) };
+    #endif
+
+    bool same = true;
+    for (const AxisShaper *s : shapers)
+      same &= s->impulses && params.frequency == s->params.frequency && params.zeta == s->params.zeta && params.type == s->params.type;
+    if (same) return true; // Leave echoes alone
+
+    const bool awake = suspend();
+    bool ok = true;
+    for (AxisShaper *s : shapers) ok &= s->set(params);
+    if (awake) {
+      restart_shaping();
+      wake_up();
+    }
+    return ok;
+  }
+
+  const shaping_params_t& Stepper::get_shaping(const AxisEnum axis) { return shaper(axis).params; }
+
+  void Stepper::suspend_shaping(const bool off) {
+    if (off == shaping_suspended) return;
+    const bool awake = suspend();
+    shaping_suspended = off;
+    restart_shaping();
+    if (awake) wake_up();
+  }
+
+  bool Stepper::shaping_busy() {
+    return TERN0(INPUT_SHAPING_X, (shaping_X.enabled && shaping_X.busy()))
+        || TERN0(INPUT_SHAPING_Y, (shaping_Y.enabled && shaping_Y.busy()));
+  }
+
+#endif // HAS_SHAPING
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
@@ -2581,6 +3261,9 @@ void Stepper::init() {
                | (INVERT_Y_DIR ? _BV(Y_AXIS) : 0)
                | (INVERT_Z_DIR ? _BV(Z_AXIS) : 0));
 
+  // Start the shapers from the directions just set
+  TERN_(HAS_SHAPING, restart_shaping());
+
   #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
     initialized = true;
     digipot_init();
@@ -2736,6 +3419,34 @@ void Stepper::report_positions() {
   report_a_position(pos);
 }
 
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+  void Stepper::reset_isr_profile() {
+    const bool was_enabled = suspend();
+    profile_pulse = profile_block = profile_advance = {};
+    profile_step_events = 0;
+    if (was_enabled) wake_up();
+  }
+
+  static void report_isr_phase(PGM_P const name, const isr_phase_profile_t &p) {
+    serialprintPGM(name);
+    SERIAL_ECHOLNPAIR(" calls:", p.calls, " avg:", p.calls ? p.ticks / p.calls : 0, " peak:", p.peak);
+  }
+
+  void Stepper::report_isr_profile() {
+    SERIAL_ECHOLNPAIR("Stepper ISR profile (ticks at ", uint32_t(STEPPER_TIMER_RATE), "Hz)");
+    report_isr_phase(PSTR(" pulse  "), profile_pulse);
+    report_isr_phase(PSTR(" block  "), profile_block);
+    TERN_(LIN_ADVANCE, report_isr_phase(PSTR(" advance"), profile_advance));
+
+    // The step rate of the leading axis the ISR could sustain if it had the whole CPU
+    const uint32_t busy = profile_pulse.ticks + profile_block.ticks + profile_advance.ticks;
+    const uint32_t max_rate = busy ? uint32_t(uint64_t(profile_step_events) * (STEPPER_TIMER_RATE) / busy) : 0;
+    SERIAL_ECHOLNPAIR("Steps:", profile_step_events, " ISR ticks:", busy, " Max step rate:", max_rate);
+  }
+
+#endif // STEPPER_ISR_PROFILING
+
 #if ENABLED(BABYSTEPPING)
 
   #define _ENABLE_AXIS(AXIS) ENABLE_AXIS_## AXIS()
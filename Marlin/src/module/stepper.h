@@ -234,6 +234,109 @@
 // Perhaps DISABLE_MULTI_STEPPING should be required with ADAPTIVE_STEP_SMOOTHING.
 #define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
 
+#if ENABLED(STEP_EVENT_SCHEDULE)
+  // Replaying a precomputed step event skips most of the base ISR
+  #define ISR_REPLAY_CYCLES ((ISR_BASE_CYCLES) / 2 + ISR_LOOP_CYCLES)
+
+  // Events closer together than this are replayed in the same ISR
+  #define MIN_SCHEDULE_EVENT_TICKS uint32_t((STEPPER_TIMER_RATE) / ((F_CPU) / (ISR_REPLAY_CYCLES)) + 1)
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+  // Time spent in one phase of the Stepper ISR, in stepper timer ticks
+  typedef struct {
+    uint32_t calls, ticks, peak;
+    void add(const uint32_t t) { calls++; ticks += t; NOLESS(peak, t); }
+  } isr_phase_profile_t;
+#endif
+
+#if HAS_SHAPING
+
+  enum ShapingType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV };
+
+  // Settings of one axis, set with M593
+  typedef struct {
+    float frequency;  // (Hz) 0 = off
+    float zeta;       // Damping ratio
+    ShapingType type;
+  } shaping_params_t;
+
+  #define SHAPING_MAX_IMPULSES  3
+  #define SHAPING_STEP          256                   // One step, in the units of the shaped position
+  #define SHAPING_THRESHOLD     (SHAPING_STEP * 5 / 8) // Step past this distance, so steps don't dither
+  #define SHAPING_NEVER         0xFFFFFFFF
+
+  // The longest echo delay, in stepper timer ticks, and the steps that can be taken in that time
+  #define SHAPING_MAX_DELAY     uint32_t((STEPPER_TIMER_RATE) * 1.25f / (SHAPING_MIN_FREQ))
+  #define SHAPING_BUFFER_SIZE   uint16_t((SHAPING_MAX_STEPRATE) * 1.25f / (SHAPING_MIN_FREQ) + 1)
+
+  /**
+   * Input shaper for one stepper axis
+   *
+   * The time of every commanded step goes into a ring buffer. Each impulse
+   * of the shaper adds a part of each step to the shaped position, after its
+   * delay. The motor steps when the shaped position is a step ahead of or
+   * behind the output position.
+   */
+  class AxisShaper {
+  public:
+    shaping_params_t params;
+    bool enabled;                               // Shaping is in use on this axis
+    bool forward;                               // The direction of the motor
+    int16_t error;                              // Shaped position minus output position
+    uint8_t impulses;
+    uint16_t amplitude[SHAPING_MAX_IMPULSES];   // Parts of a step, adding up to SHAPING_STEP
+    uint32_t delay[SHAPING_MAX_IMPULSES];       // Stepper timer ticks after the step
+    uint32_t times[SHAPING_BUFFER_SIZE];        // Stepper timer ticks of each step, with the direction in bit 0
+    uint16_t head,                              // Where the next step goes
+             peek[SHAPING_MAX_IMPULSES];        // The next step for each impulse. The last impulse has the oldest.
+
+    bool set(const shaping_params_t &p);
+    void reset() { error = 0; head = 0; LOOP_L_N(i, SHAPING_MAX_IMPULSES) peek[i] = 0; }
+    bool busy() const { return head != peek[impulses - 1] || error >= SHAPING_THRESHOLD || error <= -SHAPING_THRESHOLD; }
+
+    // Move the shaped position. Return the step to take: 1, -1, or 0.
+    FORCE_INLINE int8_t add(const int16_t part) {
+      error += part;
+      if (error >= SHAPING_THRESHOLD) { error -= SHAPING_STEP; return 1; }
+      if (error <= -SHAPING_THRESHOLD) { error += SHAPING_STEP; return -1; }
+      return 0;
+    }
+
+    // Store a commanded step and apply the first impulse
+    FORCE_INLINE int8_t push(const uint32_t now, const bool fwd) {
+      uint16_t next = head + 1;
+      if (next == SHAPING_BUFFER_SIZE) next = 0;
+      if (next == peek[impulses - 1]) flush_oldest();
+      times[head] = (now & ~1UL) | fwd;
+      head = next;
+      return add(fwd ? amplitude[0] : -amplitude[0]);
+    }
+
+    uint32_t next_echo(const uint32_t now) const;
+    bool echo(const uint32_t now, int8_t &step);
+
+  private:
+    void flush_oldest();
+  };
+
+#endif
+
+#if ENABLED(STEP_EVENT_SCHEDULE)
+  // One precomputed step event
+  typedef struct {
+    uint8_t bits;       // Axes to step, as AxisEnum bits, and the Linear Advance phase
+    hal_timer_t ticks;  // Stepper timer ticks until the next event
+  } step_event_t;
+
+  #if ENABLED(LIN_ADVANCE)
+    // The Linear Advance phase of an event, for advance_isr() when it is replayed
+    #define SCHEDULE_BIT_LA_ACCEL (E_AXIS + 1)  // Before the deceleration point
+    #define SCHEDULE_BIT_LA_DECEL (E_AXIS + 2)  // After the deceleration point
+    #define SCHEDULE_LA_PHASE (_BV(SCHEDULE_BIT_LA_ACCEL) | _BV(SCHEDULE_BIT_LA_DECEL))
+  #endif
+#endif
+
 //
 // Stepper class definition
 //
@@ -341,10 +444,46 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if HAS_SHAPING
+      static uint32_t nextShapingISR,
+                      shaping_time;           // Stepper timer ticks, for the times of the echoes
+      static bool shaping_suspended;          // Shaping is off during homing
+      #if ENABLED(INPUT_SHAPING_X)
+        static AxisShaper shaping_X;
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        static AxisShaper shaping_Y;
+      #endif
+    #endif
+
+    #if ENABLED(STEP_EVENT_SCHEDULE)
+      static step_event_t step_schedule[STEP_SCHEDULE_SIZE];
+      static uint8_t schedule_head,           // The next event to replay
+                     schedule_count;          // Events waiting to be replayed
+      static uint32_t schedule_ticks,         // Ticks covered by the waiting events
+                      schedule_wait,          // Ticks of the events already replayed, until the next one
+                      schedule_interval;      // Ticks of the last step events burst
+      static uint8_t burst_left;              // Events of the last burst not in the schedule yet
+      static hal_timer_t burst_each,          // Ticks of each event of the last burst...
+                         burst_final;         // ...and of its final event
+      #if ENABLED(LIN_ADVANCE)
+        static uint8_t burst_phase,           // Linear Advance phase of the last burst
+                       schedule_phase;        // Linear Advance phase of the last replayed event
+      #endif
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      static uint16_t arc_chord;              // The chord being stepped in the current arc block
+      static uint32_t arc_chord_events,       // Step events in each chord
+                      arc_chord_left;         // Step events left in the chord, or 0 for a straight block
+      static xy_long_t arc_r;                 // Radius vector at the end of the chord (Q8 X steps)
+      static abce_long_t arc_pos;             // Steps from the start of the arc to the end of the chord
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -376,6 +515,28 @@ class Stepper {
 
       static stepper_laser_t laser_trap;
 
+      #if ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+        static void laser_trap_rate_power(const uint32_t step_rate);
+      #endif
+
+    #endif
+
+    #if ENABLED(LASER_RASTER)
+
+      typedef struct {
+        const uint8_t *pixels;  // Pixels of the current block, or nullptr
+        uint16_t count,         // Pixels in the line
+                 index;         // The pixel being engraved
+        uint32_t events,        // Step events done at the last update
+                 acc;           // Pixel progress, in step events * pixels
+        uint8_t power;          // Power of a full pixel
+      } stepper_raster_t;
+
+      static stepper_raster_t raster;
+
+      static void set_raster_power();
+      static void finish_raster();
+
     #endif
 
   public:
@@ -422,6 +583,21 @@ class Stepper {
       }
     #endif
 
+    #if HAS_SHAPING
+      // The Input Shaping ISR phase
+      static void shaping_isr();
+
+      // Set the shaper of an axis. Call only when motion is done. Return 'false' if out of range.
+      static bool set_shaping(const AxisEnum axis, const shaping_params_t &params);
+      static const shaping_params_t& get_shaping(const AxisEnum axis);
+
+      // Turn shaping off for homing and back on after
+      static void suspend_shaping(const bool off);
+
+      // Echoes are still to be output
+      static bool shaping_busy();
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
@@ -443,6 +619,9 @@ class Stepper {
         if (IS_PAGE(current_block))
           page_manager.free_page(current_block->page_idx);
       #endif
+      #if ENABLED(LASER_RASTER)
+        if (raster.pixels) finish_raster();
+      #endif
       current_block = nullptr;
       axis_did_move = 0;
       planner.release_current_block();
@@ -514,6 +693,13 @@ class Stepper {
       static void refresh_motor_power();
     #endif
 
+    #if ENABLED(STEPPER_ISR_PROFILING)
+      static isr_phase_profile_t profile_pulse, profile_block, profile_advance;
+      static uint32_t profile_step_events;  // Steps of the leading axis in each block
+      static void reset_isr_profile();
+      static void report_isr_profile();
+    #endif
+
     // Update direction states for all steppers
     static void set_directions();
 
@@ -529,6 +715,26 @@ class Stepper {
     static void _set_position(const int32_t &a, const int32_t &b, const int32_t &c, const int32_t &e);
     FORCE_INLINE static void _set_position(const abce_long_t &spos) { _set_position(spos.a, spos.b, spos.c, spos.e); }
 
+    #if HAS_SHAPING
+      static AxisShaper& shaper(const AxisEnum axis);
+      static void restart_shaping();
+    #endif
+
+    // Update the block speed after a burst of step events. Return the ticks until the next burst.
+    static uint32_t trapezoid_interval();
+
+    #if ENABLED(ARC_PLANNER_BLOCKS)
+      // Step along the chords of an arc block
+      static void start_arc();
+      static void next_arc_chord();
+    #endif
+
+    #if ENABLED(STEP_EVENT_SCHEDULE)
+      // Precompute step events for the current block. Return the ticks until the next event.
+      static uint32_t fill_step_schedule();
+      static void push_step_event(const uint8_t bits, const hal_timer_t ticks);
+    #endif
+
     FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t* loops) {
       uint32_t timer;
 
@@ -49,7 +49,11 @@ enum StealthIndex : uint8_t { STEALTH_AXIS_XY, STEALTH_AXIS_Z, STEALTH_AXIS_E };
   #define __TMC_SPI_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(ST##_CS_PIN, float(ST##_RSENSE), ST##_CHAIN_POS)
 #endif
 
-#if ENABLED(TMC_SERIAL_MULTIPLEXER)
+#if ENABLED(TMC_ASYNC_STATUS)
+  // The TMC2208 has no address pins. The library always talks to it at address 0.
+  #define TMC_UART_HW_DEFINE(IC, ST, L, AI) TMCAsyncSerial tmc_serial##ST(ST##_HARDWARE_SERIAL, _DRIVER_ID(IC) == _TMC2208 ? 0 : ST##_SLAVE_ADDRESS); \
+                                            TMCMarlin<IC##Stepper, L, AI> stepper##ST(&tmc_serial##ST, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
+#elif ENABLED(TMC_SERIAL_MULTIPLEXER)
   #define TMC_UART_HW_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(&ST##_HARDWARE_SERIAL, float(ST##_RSENSE), ST##_SLAVE_ADDRESS, SERIAL_MUL_PIN1, SERIAL_MUL_PIN2)
 #else
   #define TMC_UART_HW_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(&ST##_HARDWARE_SERIAL, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
@@ -364,7 +368,8 @@ enum StealthIndex : uint8_t { STEALTH_AXIS_XY, STEALTH_AXIS_Z, STEALTH_AXIS_E };
       } sp_helper;
 
       #define HW_SERIAL_BEGIN(A) do{ if (!sp_helper.began(TMCAxis::A, &A##_HARDWARE_SERIAL)) \
-                                          A##_HARDWARE_SERIAL.begin(TMC_BAUD_RATE); }while(0)
+                                          A##_HARDWARE_SERIAL.begin(TMC_BAUD_RATE); \
+                                        TERN_(TMC_ASYNC_STATUS, stepper##A.shadow = &tmc_serial##A.shadow); }while(0)
     #endif
 
     #if AXIS_HAS_UART(X)
@@ -126,6 +126,75 @@
   #endif
 #endif
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  // Direct lookup tables for each sensor with a thermistor table
+  #if THERMISTOR_HEATER_0 && DISABLED(HEATER_0_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_0_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_0_TEMPTABLE);
+    #define HEATER_0_LOOKUP &heater_0_lookup
+  #else
+    #define HEATER_0_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_1 && DISABLED(HEATER_1_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_1_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_1_TEMPTABLE);
+    #define HEATER_1_LOOKUP &heater_1_lookup
+  #else
+    #define HEATER_1_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_2 && DISABLED(HEATER_2_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_2_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_2_TEMPTABLE);
+    #define HEATER_2_LOOKUP &heater_2_lookup
+  #else
+    #define HEATER_2_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_3 && DISABLED(HEATER_3_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_3_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_3_TEMPTABLE);
+    #define HEATER_3_LOOKUP &heater_3_lookup
+  #else
+    #define HEATER_3_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_4 && DISABLED(HEATER_4_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_4_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_4_TEMPTABLE);
+    #define HEATER_4_LOOKUP &heater_4_lookup
+  #else
+    #define HEATER_4_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_5 && DISABLED(HEATER_5_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_5_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_5_TEMPTABLE);
+    #define HEATER_5_LOOKUP &heater_5_lookup
+  #else
+    #define HEATER_5_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_6 && DISABLED(HEATER_6_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_6_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_6_TEMPTABLE);
+    #define HEATER_6_LOOKUP &heater_6_lookup
+  #else
+    #define HEATER_6_LOOKUP nullptr
+  #endif
+  #if THERMISTOR_HEATER_7 && DISABLED(HEATER_7_USER_THERMISTOR)
+    constexpr temp_lookup_t heater_7_lookup PROGMEM = TT_LOOKUP_TABLE(HEATER_7_TEMPTABLE);
+    #define HEATER_7_LOOKUP &heater_7_lookup
+  #else
+    #define HEATER_7_LOOKUP nullptr
+  #endif
+  #if THERMISTORBED && DISABLED(HEATER_BED_USER_THERMISTOR)
+    constexpr temp_lookup_t bed_lookup PROGMEM = TT_LOOKUP_TABLE(BED_TEMPTABLE);
+  #endif
+  #if THERMISTORCHAMBER && DISABLED(HEATER_CHAMBER_USER_THERMISTOR)
+    constexpr temp_lookup_t chamber_lookup PROGMEM = TT_LOOKUP_TABLE(CHAMBER_TEMPTABLE);
+  #endif
+  #if THERMISTORPROBE && DISABLED(PROBE_USER_THERMISTOR)
+    constexpr temp_lookup_t probe_lookup PROGMEM = TT_LOOKUP_TABLE(PROBE_TEMPTABLE);
+  #endif
+  #if HOTEND_USES_THERMISTOR
+    #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
+      static const temp_lookup_t* heater_lookup_map[2] = { HEATER_0_LOOKUP, HEATER_1_LOOKUP };
+    #else
+      #define NEXT_LOOKUP(N) ,HEATER_##N##_LOOKUP
+      static const temp_lookup_t* heater_lookup_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_LOOKUP REPEAT_S(1, HOTENDS, NEXT_LOOKUP));
+    #endif
+  #endif
+#endif
+
 Temperature thermalManager;
 
 const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
@@ -1330,10 +1399,34 @@ void Temperature::manage_heater() {
   }                                                                   \
 }while(0)
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  /**
+   * Jump to the table segment given by the direct lookup table,
+   * then interpolate just like SCAN_THERMISTOR_TABLE.
+   */
+  #define LOOKUP_THERMISTOR_TABLE(TBL,LEN,LUT) do{                      \
+    const int16_t r = constrain(raw, 0, int(MAX_RAW_THERMISTOR_VALUE));      \
+    uint8_t i = pgm_read_byte(&(LUT).index[r >> (THERMISTOR_LOOKUP_SHIFT)]); \
+    while (i < LEN && r > int16_t(pgm_read_word(&TBL[i].value))) i++;   \
+    if (!i) return int16_t(pgm_read_word(&TBL[0].celsius));             \
+    if (i == LEN) return int16_t(pgm_read_word(&TBL[LEN-1].celsius));   \
+    const int16_t v00 = pgm_read_word(&TBL[i-1].value),                 \
+                  v10 = pgm_read_word(&TBL[i-0].value),                 \
+                  v01 = int16_t(pgm_read_word(&TBL[i-1].celsius)),      \
+                  v11 = int16_t(pgm_read_word(&TBL[i-0].celsius));      \
+    return v01 + (r - v00) * float(v11 - v01) / float(v10 - v00);       \
+  }while(0)
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
 
+  #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+    // Curves tabulated in 1/16 °C when the thermistor parameters change
+    static int16_t user_thermistor_lookup[USER_THERMISTORS][THERMISTOR_LOOKUP_INTERVALS + 1];
+  #endif
+
   void Temperature::reset_user_thermistors() {
     user_thermistor_t user_thermistor[USER_THERMISTORS] = {
       #if ENABLED(HEATER_0_USER_THERMISTOR)
@@ -1403,12 +1496,6 @@ void Temperature::manage_heater() {
   }
 
   float Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int raw) {
-    //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
-    //  static uint32_t clocks_total = 0;
-    //  static uint32_t calls = 0;
-    //  uint32_t tcnt5 = TCNT5;
-    //#endif
-
     if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
 
     user_thermistor_t &t = user_thermistor[t_index];
@@ -1419,8 +1506,32 @@ void Temperature::manage_heater() {
       t.beta_recip   = 1.0f / t.beta;
       t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
                         - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        // Evaluate the curve once per table entry instead of once per reading
+        for (uint16_t k = 0; k <= THERMISTOR_LOOKUP_INTERVALS; k++)
+          user_thermistor_lookup[t_index][k] = LROUND(16 * constrain(user_thermistor_curve(t, int32_t(k) << (THERMISTOR_LOOKUP_SHIFT)), -2000, 2000));
+      #endif
     }
 
+    #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+      // Interpolate between the two entries around 'raw'
+      const int16_t r = constrain(raw, 0, int(MAX_RAW_THERMISTOR_VALUE)),
+                    *c = &user_thermistor_lookup[t_index][r >> (THERMISTOR_LOOKUP_SHIFT)];
+      constexpr int16_t mask = _BV(THERMISTOR_LOOKUP_SHIFT) - 1;
+      return (c[0] + (c[1] - c[0]) * float(r & mask) * (1.0f / (mask + 1))) * (1.0f / 16);
+    #else
+      return user_thermistor_curve(t, raw);
+    #endif
+  }
+
+  // Degrees C for a raw reading, by the Steinhart-Hart equation
+  float Temperature::user_thermistor_curve(const user_thermistor_t &t, const int32_t raw) {
+    //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
+    //  static uint32_t clocks_total = 0;
+    //  static uint32_t calls = 0;
+    //  uint32_t tcnt5 = TCNT5;
+    //#endif
+
     // maximum adc value .. take into account the over sampling
     const int adc_max = MAX_RAW_THERMISTOR_VALUE,
               adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -1554,7 +1665,11 @@ void Temperature::manage_heater() {
       default: break;
     }
 
-    #if HOTEND_USES_THERMISTOR
+    #if HOTEND_USES_THERMISTOR && ENABLED(THERMISTOR_DIRECT_LOOKUP)
+      // Thermistor with conversion table and direct lookup table
+      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+      LOOKUP_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e], (*heater_lookup_map[e]));
+    #elif HOTEND_USES_THERMISTOR
       // Thermistor with conversion table?
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
       SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
@@ -1571,7 +1686,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_BED_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif ENABLED(HEATER_BED_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        LOOKUP_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN, bed_lookup);
+      #else
+        SCAN_THERMISTOR_TABLE(BED_TEMPTABLE, BED_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_BED_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_BED_USES_AD8495)
@@ -1590,7 +1709,11 @@ void Temperature::manage_heater() {
     #if ENABLED(HEATER_CHAMBER_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif ENABLED(HEATER_CHAMBER_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        LOOKUP_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN, chamber_lookup);
+      #else
+        SCAN_THERMISTOR_TABLE(CHAMBER_TEMPTABLE, CHAMBER_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(HEATER_CHAMBER_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(HEATER_CHAMBER_USES_AD8495)
@@ -1609,7 +1732,11 @@ void Temperature::manage_heater() {
     #if ENABLED(PROBE_USER_THERMISTOR)
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif ENABLED(PROBE_USES_THERMISTOR)
-      SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        LOOKUP_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN, probe_lookup);
+      #else
+        SCAN_THERMISTOR_TABLE(PROBE_TEMPTABLE, PROBE_TEMPTABLE_LEN);
+      #endif
     #elif ENABLED(PROBE_USES_AD595)
       return TEMP_AD595(raw);
     #elif ENABLED(PROBE_USES_AD8495)
@@ -24,7 +24,7 @@
 #define REVERSE_TEMP_SENSOR_RANGE_1047 1
 
 // Pt1000 with 4k7 pullup
-const temp_entry_t temptable_1047[] PROGMEM = {
+constexpr temp_entry_t temptable_1047[] PROGMEM = {
   // only a few values are needed as the curve is very flat
   PtLine(  0, 1000, 4700),
   PtLine( 50, 1000, 4700),
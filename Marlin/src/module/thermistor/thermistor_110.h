@@ -24,7 +24,7 @@
 #define REVERSE_TEMP_SENSOR_RANGE_110 1
 
 // Pt100 with 1k0 pullup
-const temp_entry_t temptable_110[] PROGMEM = {
+constexpr temp_entry_t temptable_110[] PROGMEM = {
   // only a few values are needed as the curve is very flat
   PtLine(  0, 100, 1000),
   PtLine( 50, 100, 1000),
@@ -27,7 +27,7 @@
 #define OV_SCALE(N) (float((N) * 5) / 3.3f)
 
 // Pt100 with INA826 amp with 3.3v excitation based on "Pt100 with INA826 amp on Ultimaker v2.0 electronics"
-const temp_entry_t temptable_21[] PROGMEM = {
+constexpr temp_entry_t temptable_21[] PROGMEM = {
   { OV(  0),    0 },
   { OV(227),    1 },
   { OV(236),   10 },
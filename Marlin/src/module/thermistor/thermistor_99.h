@@ -24,7 +24,7 @@
 
 // 100k bed thermistor with a 10K pull-up resistor - made by $ buildroot/share/scripts/createTemperatureLookupMarlin.py --rp=10000
 
-const temp_entry_t temptable_99[] PROGMEM = {
+constexpr temp_entry_t temptable_99[] PROGMEM = {
   { OV(  5.81), 350 }, // v=0.028   r=    57.081  res=13.433 degC/count
   { OV(  6.54), 340 }, // v=0.032   r=    64.248  res=11.711 degC/count
   { OV(  7.38), 330 }, // v=0.036   r=    72.588  res=10.161 degC/count
@@ -190,7 +190,7 @@ typedef struct { int16_t value, celsius; } temp_entry_t;
   #include "thermistor_999.h"
 #endif
 #if ANY_THERMISTOR_IS(1000) // Custom
-  const temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
+  constexpr temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
 #endif
 
 #define _TT_NAME(_N) temptable_ ## _N
@@ -315,6 +315,43 @@ static_assert(
   "Temperature conversion tables over 255 entries need special consideration."
 );
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+
+  /**
+   * Direct lookup tables, computed by the compiler from the tables above.
+   *
+   * Entry K holds the index of the first table entry at or above the raw
+   * value K << THERMISTOR_LOOKUP_SHIFT, so a reading lands on its table
+   * segment in one step (plus one per extra table entry in its interval)
+   * instead of by bisection. The interpolation is the same as the search.
+   */
+  #define THERMISTOR_LOOKUP_INTERVALS TERN(THERMISTOR_COMPACT_LOOKUP, 64, 256)
+  #define THERMISTOR_LOOKUP_SHIFT (HAL_ADC_RESOLUTION + TERN(HAL_ADC_FILTERED, 0, 4) - TERN(THERMISTOR_COMPACT_LOOKUP, 6, 8))
+
+  static_assert(_BV32(THERMISTOR_LOOKUP_SHIFT) * (THERMISTOR_LOOKUP_INTERVALS) == uint32_t(HAL_ADC_RANGE) * (OVERSAMPLENR),
+    "THERMISTOR_DIRECT_LOOKUP needs the oversampled ADC range to be a power of 2.");
+
+  typedef struct { uint8_t index[THERMISTOR_LOOKUP_INTERVALS]; } temp_lookup_t;
+
+  // The first entry of 'tbl' with a value of 'raw' or more, or 'len' if none
+  constexpr uint8_t tt_index(const temp_entry_t * const tbl, const uint8_t len, const int32_t raw, const uint8_t i=0) {
+    return i >= len || tbl[i].value >= raw ? i : tt_index(tbl, len, raw, i + 1);
+  }
+
+  // An index sequence for C++11
+  template<int...> struct tt_indices {};
+  template<int N, int... I> struct tt_make_indices : tt_make_indices<N - 1, N - 1, I...> {};
+  template<int... I> struct tt_make_indices<0, I...> { typedef tt_indices<I...> type; };
+
+  template<int... I>
+  constexpr temp_lookup_t _tt_lookup_table(const temp_entry_t * const tbl, const uint8_t len, tt_indices<I...>) {
+    return {{ tt_index(tbl, len, int32_t(I) << (THERMISTOR_LOOKUP_SHIFT))... }};
+  }
+
+  #define TT_LOOKUP_TABLE(TBL) _tt_lookup_table(TBL, COUNT(TBL), tt_make_indices<THERMISTOR_LOOKUP_INTERVALS>::type())
+
+#endif
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
@@ -685,7 +685,7 @@
 //
 
 #elif MB(LINUX_RAMPS)
-  #include "linux/pins_RAMPS_LINUX.h"           // Linux                                  env:linux_native
+  #include "linux/pins_RAMPS_LINUX.h"           // Linux                                  env:linux_native env:linux_native_sim env:linux_native_bench
 
 #else
 
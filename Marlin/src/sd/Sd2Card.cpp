@@ -89,6 +89,11 @@
 
 // Send command and return error code. Return zero for OK
 uint8_t Sd2Card::cardCommand(const uint8_t cmd, const uint32_t arg) {
+  #if ENABLED(SD_READ_AHEAD)
+    // Any other command ends an open multiple block read
+    if (streamBlock_ && cmd != CMD12) readStop();
+  #endif
+
   // Select card
   chipSelect();
 
@@ -239,6 +244,7 @@ bool Sd2Card::init(const uint8_t sckRateID, const pin_t chipSelectPin) {
   #endif
 
   errorCode_ = type_ = 0;
+  TERN_(SD_READ_AHEAD, streamBlock_ = 0);
   chipSelectPin_ = chipSelectPin;
   // 16-bit init start time allows over a minute
   const millis_t init_timeout = millis() + SD_INIT_TIMEOUT;
@@ -512,6 +518,7 @@ bool Sd2Card::readStart(uint32_t blockNumber) {
  * \return true for success, false for failure.
  */
 bool Sd2Card::readStop() {
+  TERN_(SD_READ_AHEAD, streamBlock_ = 0);
   chipSelect();
   const bool success = !cardCommand(CMD12, 0);
   if (!success) error(SD_CARD_ERROR_CMD12);
@@ -519,6 +526,39 @@ bool Sd2Card::readStop() {
   return success;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read a block as part of a multiple block read, starting a new sequence
+   * if the block doesn't follow the last one read. Sequential reads skip the
+   * per-block command overhead of readBlock(). The sequence is ended by
+   * readStop() or by any other card command.
+   *
+   * \param[in] blockNumber Logical block to be read.
+   * \param[out] dst Pointer to the location that will receive the data.
+   * \return true for success, false for failure.
+   */
+  bool Sd2Card::readStream(const uint32_t blockNumber, uint8_t* dst) {
+    #if IS_TEENSY_35_36 || IS_TEENSY_40_41
+      return readBlock(blockNumber, dst);
+    #endif
+
+    if (blockNumber != streamBlock_) {
+      if (streamBlock_) readStop();
+      if (!readStart(blockNumber)) return false;
+    }
+    if (readData(dst)) {
+      streamBlock_ = blockNumber + 1;
+      return true;
+    }
+    // Drop out of the sequence and let readBlock() handle the retry
+    readStop();
+    errorCode_ = 0;
+    return readBlock(blockNumber, dst);
+  }
+
+#endif // SD_READ_AHEAD
+
 /**
  * Set the SPI clock rate.
  *
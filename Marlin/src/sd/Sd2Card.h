@@ -96,7 +96,7 @@ uint8_t const SD_CARD_TYPE_SD1  = 1,                    // Standard capacity V1
 class Sd2Card {
 public:
 
-  Sd2Card() : errorCode_(SD_CARD_ERROR_INIT_NOT_CALLED), type_(0) {}
+  Sd2Card() : errorCode_(SD_CARD_ERROR_INIT_NOT_CALLED), type_(0) { TERN_(SD_READ_AHEAD, streamBlock_ = 0); }
 
   uint32_t cardSize();
   bool erase(uint32_t firstBlock, uint32_t lastBlock);
@@ -150,6 +150,9 @@ public:
   bool readData(uint8_t* dst);
   bool readStart(uint32_t blockNumber);
   bool readStop();
+  #if ENABLED(SD_READ_AHEAD)
+    bool readStream(const uint32_t blockNumber, uint8_t* dst);
+  #endif
   bool setSckRate(const uint8_t sckRateID);
 
   /**
@@ -169,6 +172,10 @@ private:
           status_,
           type_;
 
+  #if ENABLED(SD_READ_AHEAD)
+    uint32_t streamBlock_;  // Next block of an open multiple block read, or 0
+  #endif
+
   // private functions
   inline uint8_t cardAcmd(const uint8_t cmd, const uint32_t arg) {
     cardCommand(CMD55, 0);
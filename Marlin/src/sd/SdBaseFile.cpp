@@ -1032,7 +1032,7 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!nextCluster(curPosition_, &curCluster_))  // get next cluster
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1059,6 +1059,61 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   return nbyte;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read a whole block of the file without moving the file position.
+   * Blocks read in order are fetched with a single multiple block read.
+   *
+   * \param[in] pos Block-aligned position in the file.
+   *
+   * \param[in,out] cluster The cluster holding the byte before \a pos.
+   * Updated to the cluster holding the block that was read.
+   *
+   * \param[out] dst Pointer to a 512 byte buffer for the data.
+   *
+   * \return true for success, false for failure or if \a pos is past the end.
+   */
+  bool SdBaseFile::readAhead(const uint32_t pos, uint32_t &cluster, uint8_t* dst) {
+    if (!isOpen() || !(flags_ & O_READ) || pos >= fileSize_) return false;
+
+    uint32_t block;
+    if (type_ == FAT_FILE_TYPE_ROOT_FIXED)
+      block = vol_->rootDirStart() + (pos >> 9);
+    else {
+      const uint8_t blockOfCluster = vol_->blockOfCluster(pos);
+      if (blockOfCluster == 0) {
+        // start of new cluster
+        if (pos == 0)
+          cluster = firstCluster_;
+        else if (!nextCluster(pos, &cluster))
+          return false;
+      }
+      block = vol_->clusterStartBlock(cluster) + blockOfCluster;
+    }
+    return vol_->readStream(block, dst);
+  }
+
+#endif // SD_READ_AHEAD
+
+/**
+ * Get the cluster following the given one in the file's chain, from
+ * the cached chain if possible so the FAT isn't read.
+ *
+ * \param[in] pos The file position at the start of the next cluster.
+ * \param[in,out] cluster The current cluster, replaced by the next one.
+ *
+ * \return true for success, false for failure.
+ */
+bool SdBaseFile::nextCluster(const uint32_t pos, uint32_t* cluster) {
+  #if ENABLED(SD_CLUSTER_CACHE)
+    if (vol_->cachedCluster(firstCluster_, pos >> (vol_->clusterSizeShift_ + 9), cluster)) return true;
+  #else
+    UNUSED(pos);
+  #endif
+  return vol_->fatGet(*cluster, cluster);
+}
+
 /**
  * Read the next entry in a directory.
  *
@@ -1422,6 +1477,14 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    // look up the new cluster without walking the FAT
+    if (vol_->cachedCluster(firstCluster_, nNew, &curCluster_)) {
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
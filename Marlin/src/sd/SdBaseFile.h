@@ -301,6 +301,12 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void* buf, uint16_t nbyte);
+  #if ENABLED(SD_CLUSTER_CACHE)
+    bool cacheClusters() { return isFile() && vol_->cacheChain(firstCluster_); }
+  #endif
+  #if ENABLED(SD_READ_AHEAD)
+    bool readAhead(const uint32_t pos, uint32_t &cluster, uint8_t* dst);
+  #endif
   int8_t readDir(dir_t* dir, char* longFilename);
   static bool remove(SdBaseFile* dirFile, const char* path);
   bool remove();
@@ -379,6 +385,7 @@ class SdBaseFile {
   bool addDirCluster();
   dir_t* cacheDirEntry(uint8_t action);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
+  bool nextCluster(const uint32_t pos, uint32_t* cluster);
   static bool make83Name(const char* str, uint8_t* name, const char** ptr);
   bool mkdir(SdBaseFile* parent, const uint8_t dname[11]);
   bool open(SdBaseFile* dirFile, const uint8_t dname[11], uint8_t oflag);
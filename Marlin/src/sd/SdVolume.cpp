@@ -192,6 +192,72 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
   return true;
 }
 
+#if ENABLED(SD_CLUSTER_CACHE)
+
+  /**
+   * Cache the cluster chain starting at the given cluster as a list of
+   * contiguous runs, replacing any chain cached before. If the chain has
+   * more runs than SD_CLUSTER_CACHE_EXTENTS only its start is cached.
+   *
+   * \param[in] cluster The first cluster of the chain.
+   * \return true for success, false for failure.
+   */
+  bool SdVolume::cacheChain(uint32_t cluster) {
+    const uint32_t chain = cluster;
+    uint32_t index = 0, last = 0;
+    extentChain_ = 0;
+    extentCount_ = 0;
+    if (cluster < 2) return false;
+    for (;;) {
+      // start a new run if this cluster doesn't follow the last one
+      if (cluster != last + 1) {
+        if (extentCount_ == SD_CLUSTER_CACHE_EXTENTS) break;
+        extent_[extentCount_].cluster = cluster;
+        extent_[extentCount_].index = index;
+        extentCount_++;
+      }
+      last = cluster;
+      index++;
+      if (index > clusterCount_) return false;  // corrupt chain
+      if (!fatGet(cluster, &cluster)) return false;
+      if (isEOC(cluster)) break;
+    }
+    extentEnd_ = index;
+    extentChain_ = chain;
+    return true;
+  }
+
+  /**
+   * Look up a cluster of the cached chain.
+   *
+   * \param[in] chain The first cluster of the chain.
+   * \param[in] index The position of the wanted cluster in the chain.
+   * \param[out] cluster The cluster number.
+   * \return true if found, false if the chain or that part of it isn't cached.
+   */
+  bool SdVolume::cachedCluster(uint32_t chain, uint32_t index, uint32_t* cluster) {
+    if (chain != extentChain_ || index >= extentEnd_) return false;
+    uint8_t lo = 0, hi = extentCount_ - 1;
+    while (lo < hi) {
+      const uint8_t mid = (lo + hi + 1) >> 1;
+      if (extent_[mid].index <= index) lo = mid; else hi = mid - 1;
+    }
+    *cluster = extent_[lo].cluster + (index - extent_[lo].index);
+    return true;
+  }
+
+  // Is the cluster part of the cached chain?
+  bool SdVolume::chainCached(uint32_t cluster) {
+    if (!extentChain_) return false;
+    LOOP_L_N(i, extentCount_) {
+      const uint32_t end = (i + 1 < extentCount_ ? extent_[i + 1].index : extentEnd_) - extent_[i].index;
+      if (cluster >= extent_[i].cluster && cluster - extent_[i].cluster < end) return true;
+    }
+    return false;
+  }
+
+#endif // SD_CLUSTER_CACHE
+
 // Store a FAT entry
 bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -203,6 +269,10 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   // error if not in FAT
   if (cluster > (clusterCount_ + 1)) return false;
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    if (chainCached(cluster)) extentChain_ = 0;  // the cached chain is changing
+  #endif
+
   if (FAT12_SUPPORT && fatType_ == 12) {
     uint16_t index = cluster;
     index += index >> 1;
@@ -334,6 +404,7 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_CLUSTER_CACHE, extentChain_ = 0);
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
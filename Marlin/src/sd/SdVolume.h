@@ -129,6 +129,10 @@ class SdVolume {
    */
   bool dbgFat(uint32_t n, uint32_t* v) { return fatGet(n, v); }
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    bool cacheChain(uint32_t cluster);
+  #endif
+
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
@@ -164,6 +168,21 @@ class SdVolume {
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    // Contiguous runs of one cluster chain, so files can be read and
+    // positioned without FAT lookups evicting the block cache.
+    typedef struct {
+      uint32_t cluster,         // First cluster of the run
+               index;           // Position of the run in the chain, in clusters
+    } extent_t;
+    extent_t extent_[SD_CLUSTER_CACHE_EXTENTS];
+    uint8_t extentCount_;       // number of runs in extent_
+    uint32_t extentChain_;      // first cluster of the cached chain, 0 for none
+    uint32_t extentEnd_;        // number of clusters covered by extent_
+    bool cachedCluster(uint32_t chain, uint32_t index, uint32_t* cluster);
+    bool chainCached(uint32_t cluster);
+  #endif
+
   bool allocContiguous(uint32_t count, uint32_t* curCluster);
   uint8_t blockOfCluster(uint32_t position) const { return (position >> 9) & (blocksPerCluster_ - 1); }
   uint32_t clusterStartBlock(uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
@@ -197,5 +216,8 @@ class SdVolume {
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t* dst) { return sdCard_->readBlock(block, dst); }
+  #if ENABLED(SD_READ_AHEAD)
+    bool readStream(uint32_t block, uint8_t* dst) { return sdCard_->readStream(block, dst); }
+  #endif
   bool writeBlock(uint32_t block, const uint8_t* dst) { return sdCard_->writeBlock(block, dst); }
 };
@@ -124,6 +124,12 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+  uint8_t CardReader::ra_index, CardReader::ra_count;
+  uint32_t CardReader::ra_pos, CardReader::ra_fill_pos, CardReader::ra_cluster;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -155,16 +161,17 @@ CardReader::CardReader() {
 //
 // Get a DOS 8.3 filename in its useful form
 //
-char *createFilename(char * const buffer, const dir_t &p) {
+char *createFilename(char * const buffer, const uint8_t * const name) {
   char *pos = buffer;
   LOOP_L_N(i, 11) {
-    if (p.name[i] == ' ') continue;
+    if (name[i] == ' ') continue;
     if (i == 8) *pos++ = '.';
-    *pos++ = p.name[i];
+    *pos++ = name[i];
   }
   *pos++ = 0;
   return buffer;
 }
+char *createFilename(char * const buffer, const dir_t &p) { return createFilename(buffer, p.name); }
 
 //
 // Return 'true' if the item is a folder or G-code file
@@ -206,9 +213,9 @@ int CardReader::countItems(SdFile dir) {
 //
 // Get file/folder info for an item by index
 //
-void CardReader::selectByIndex(SdFile dir, const uint8_t index) {
+void CardReader::selectByIndex(SdFile dir, const uint16_t index) {
   dir_t p;
-  for (uint8_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
+  for (uint16_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
     if (is_dir_or_gcode(p)) {
       if (cnt == index) {
         createFilename(filename, p);
@@ -232,6 +239,19 @@ void CardReader::selectByName(SdFile dir, const char * const match) {
   }
 }
 
+#if ENABLED(SD_DIR_INDEX)
+
+  //
+  // Get file/folder info for an item from the folder index
+  //
+  void CardReader::selectRecord(const dir_index_record_t &rec) {
+    createFilename(filename, rec.name);
+    memcpy(longFilename, rec.longname, sizeof(longFilename));
+    flag.filenameIsDir = rec.attributes & DIR_ATT_DIRECTORY;
+  }
+
+#endif
+
 //
 // Recursive method to list all files within a folder
 //
@@ -288,6 +308,129 @@ void CardReader::ls() {
   }
 }
 
+#if ENABLED(SD_PAGED_LISTING)
+
+  //
+  // Base64 for binary listing pages, sent a byte at a time
+  //
+  static uint32_t b64_bits;
+  static uint8_t b64_count;
+
+  static void b64_print(const uint8_t chars) {
+    static const char b64_chars[] PROGMEM = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (int8_t s = 18; s > 18 - 6 * chars; s -= 6)
+      SERIAL_CHAR(pgm_read_byte(&b64_chars[(b64_bits >> s) & 0x3F]));
+  }
+
+  static void b64_put(const uint8_t b) {
+    b64_bits = (b64_bits << 8) | b;
+    if (++b64_count == 3) {
+      b64_print(4);
+      b64_bits = b64_count = 0;
+    }
+  }
+
+  static void b64_finish() {
+    if (!b64_count) return;
+    b64_bits <<= 8 * (3 - b64_count);
+    b64_print(b64_count + 1);
+    LOOP_L_N(i, 3 - b64_count) SERIAL_CHAR('=');
+  }
+
+  //
+  // Print one item of a listing page
+  //
+  static void printListingText(const sd_listing_record_t &rec) {
+    SERIAL_ECHO(rec.index);
+    SERIAL_CHAR(' ');
+    SERIAL_ECHO(rec.size);
+    SERIAL_CHAR(' ');
+    SERIAL_ECHO(rec.filename);
+    if (rec.attributes & DIR_ATT_DIRECTORY) SERIAL_CHAR('/');
+    if (rec.longname[0]) { SERIAL_CHAR(' '); SERIAL_ECHO(rec.longname); }
+    SERIAL_EOL();
+  }
+
+  static uint16_t page_items;
+
+  static void printListingBinary(const sd_listing_record_t &rec) {
+    const uint8_t * const bytes = (const uint8_t*)&rec;
+    LOOP_L_N(i, sizeof(rec)) b64_put(bytes[i]);
+    page_items++;
+  }
+
+  //
+  // Pass up to 'count' items of the working folder, starting at index 'start', to 'item'.
+  // Return the index for the next page, or -1 after the last item.
+  //
+  int32_t CardReader::listPage(const uint16_t start, const uint16_t count, void (*item)(const sd_listing_record_t &rec)) {
+    sd_listing_record_t rec;
+    uint16_t left = count;
+    int32_t next = -1;
+
+    #if ENABLED(SD_DIR_INDEX)
+      if (dir_index.use(workDir)) {
+        // Read the items directly from the folder index
+        dir_index_record_t irec;
+        const uint16_t total = dir_index.count();
+        uint16_t nr = start;
+        for (; left && nr < total && dir_index.get(nr, irec); left--, nr++) {
+          memset(&rec, 0, sizeof(rec)); // Binary pages are sent whole
+          rec.index = nr;
+          rec.attributes = irec.attributes;
+          rec.size = irec.size;
+          createFilename(rec.filename, irec.name);
+          strncpy(rec.longname, irec.longname, sizeof(rec.longname) - 1);
+          item(rec);
+        }
+        if (nr < total) next = nr;
+      }
+      else
+    #endif
+    {
+      // Scan the folder, skipping the items before the page
+      dir_t p;
+      workDir.rewind();
+      for (uint16_t nr = 0; workDir.readDir(&p, longFilename) > 0;) {
+        if (!is_dir_or_gcode(p)) continue;
+        if (nr >= start) {
+          if (!left) { next = nr; break; }
+          memset(&rec, 0, sizeof(rec));
+          rec.index = nr;
+          rec.attributes = p.attributes;
+          rec.size = p.fileSize;
+          createFilename(rec.filename, p);
+          strncpy(rec.longname, longFilename, sizeof(rec.longname) - 1);
+          item(rec);
+          left--;
+        }
+        nr++;
+      }
+    }
+
+    return next;
+  }
+
+  //
+  // List up to 'count' items of the working folder, starting at index 'start'.
+  // A binary page is one line, "Page:<record size>:", the records in base64, and ":<items>".
+  // The item count comes last so the folder is only read once.
+  // Return the index for the next page, or -1 after the last item.
+  //
+  int32_t CardReader::lsPage(const uint16_t start, const uint16_t count, const bool binary/*=false*/) {
+    if (!binary) return listPage(start, count, printListingText);
+
+    SERIAL_ECHOPAIR("Page:", int(sizeof(sd_listing_record_t)), ":");
+    b64_bits = b64_count = 0;
+    page_items = 0;
+    const int32_t next = listPage(start, count, printListingBinary);
+    b64_finish();
+    SERIAL_ECHOLNPAIR(":", page_items);
+    return next;
+  }
+
+#endif // SD_PAGED_LISTING
+
 #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
 
   //
@@ -374,6 +517,8 @@ void CardReader::printFilename() {
 void CardReader::mount() {
   flag.mounted = false;
   if (root.isOpen()) root.close();
+  TERN_(SD_DIR_INDEX, dir_index.invalidate());
+  TERN_(POWER_LOSS_JOURNAL, recovery.close());
 
   if (!sd2card.init(SPI_SPEED, SDSS)
     #if defined(LCD_SDSS) && (LCD_SDSS != SDSS)
@@ -454,6 +599,8 @@ void CardReader::release() {
   endFilePrint();
   flag.mounted = false;
   flag.workDirIsRoot = true;
+  TERN_(SD_DIR_INDEX, dir_index.invalidate());
+  TERN_(POWER_LOSS_JOURNAL, recovery.close());
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
@@ -479,7 +626,9 @@ void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.sdprinting = flag.abort_sd_printing = false;
+  TERN_(SD_READ_AHEAD, flag.read_ahead = false);
   if (isFileOpen()) file.close();
+  TERN_(SD_PREFETCH_COMMANDS, queue.sd_prefetch_clear());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -555,13 +704,14 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
         return;
       }
 
-      // Store current filename (based on workDirParents) and position
+      // Store current filename (based on workDirParents) and position.
+      // Prefetched lines that aren't queued yet are read again on return.
       getAbsFilename(proc_filenames[file_subcall_ctr]);
-      filespos[file_subcall_ctr] = sdpos;
+      filespos[file_subcall_ctr] = TERN(SD_PREFETCH_COMMANDS, queue.sd_queued_pos, sdpos);
 
       // For sub-procedures say 'SUBROUTINE CALL target: "..." parent: "..." pos12345'
       SERIAL_ECHO_START();
-      SERIAL_ECHOLNPAIR("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", sdpos);
+      SERIAL_ECHOLNPAIR("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", filespos[file_subcall_ctr]);
       file_subcall_ctr++;
       break;
 
@@ -579,6 +729,8 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_PREFETCH_COMMANDS, queue.sd_prefetch_clear());
+    TERN_(SD_CLUSTER_CACHE, file.cacheClusters());
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -616,6 +768,7 @@ void CardReader::openFileWrite(char * const path) {
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      TERN_(SD_DIR_INDEX, dir_index.invalidate());
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -659,6 +812,7 @@ void CardReader::removeFile(const char * const name) {
   #else
     if (file.remove(curDir, fname)) {
       SERIAL_ECHOLNPAIR("File deleted:", fname);
+      TERN_(SD_DIR_INDEX, dir_index.invalidate());
       sdpos = 0;
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
@@ -737,6 +891,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
+  TERN_(SD_READ_AHEAD, flag.read_ahead = false);
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -758,6 +913,13 @@ void CardReader::selectFileByIndex(const uint16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    dir_index_record_t rec;
+    if (dir_index.use(workDir)) {
+      if (dir_index.get(nr, rec)) selectRecord(rec);
+      return;
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -775,11 +937,26 @@ void CardReader::selectFileByName(const char * const match) {
         return;
       }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    dir_index_record_t rec;
+    if (dir_index.use(workDir)) {
+      if (dir_index.find(match, rec) >= 0) selectRecord(rec);
+      return;
+    }
+  #endif
   workDir.rewind();
   selectByName(workDir, match);
 }
 
 uint16_t CardReader::countFilesInWorkDir() {
+  #if ENABLED(SD_DIR_INDEX)
+    if (dir_index.use(workDir)) {
+      #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
+        nrFiles = dir_index.count();
+      #endif
+      return dir_index.count();
+    }
+  #endif
   workDir.rewind();
   return countItems(workDir);
 }
@@ -895,6 +1072,21 @@ void CardReader::cd(const char * relpath) {
   }
 }
 
+#if ENABLED(SD_PAGED_LISTING)
+
+  //
+  // Enter the folder at an index of the working folder, in folder order
+  //
+  bool CardReader::cdIndex(const uint16_t nr) {
+    filename[0] = '\0';
+    selectFileByIndex(nr);
+    if (!filename[0] || !flag.filenameIsDir) return false;
+    cd(filename);
+    return true;
+  }
+
+#endif
+
 int8_t CardReader::cdup() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
@@ -976,6 +1168,16 @@ void CardReader::cdroot() {
       // Sort order is always needed. May be static or dynamic.
       TERN_(SDSORT_DYNAMIC_RAM, sort_order = new uint8_t[fileCnt]);
 
+      // Reuse the order saved in the folder index, if still valid.
+      // (With SDSORT_USES_RAM all the names are read in anyway.)
+      #if ENABLED(SD_DIR_INDEX) && DISABLED(SDSORT_USES_RAM)
+        #define DIR_INDEX_SORT_MODE TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING)
+        if (dir_index.load_order(sort_order, fileCnt, DIR_INDEX_SORT_MODE)) {
+          sort_count = fileCnt;
+          return;
+        }
+      #endif
+
       // Use RAM to store the entire directory during pre-sort.
       // SDSORT_LIMIT should be set to prevent over-allocation.
       #if ENABLED(SDSORT_USES_RAM)
@@ -1118,6 +1320,9 @@ void CardReader::cdroot() {
         #endif
       }
 
+      #if ENABLED(SD_DIR_INDEX) && DISABLED(SDSORT_USES_RAM)
+        dir_index.save_order(sort_order, fileCnt, DIR_INDEX_SORT_MODE);
+      #endif
       sort_count = fileCnt;
     }
   }
@@ -1152,11 +1357,19 @@ uint16_t CardReader::get_num_Files() {
   );
 }
 
+void CardReader::setIndex(const uint32_t index) {
+  TERN_(SD_READ_AHEAD, flag.read_ahead = false);
+  sdpos = index;
+  file.seekSet(index);
+  TERN_(SD_PREFETCH_COMMANDS, queue.sd_prefetch_clear()); // Read on from the new position
+}
+
 //
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
   planner.synchronize();
+  TERN_(SD_READ_AHEAD, flag.read_ahead = false);
   file.close();
   if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
     file_subcall_ctr--;
@@ -1188,6 +1401,67 @@ void CardReader::fileHasFinished() {
   }
 #endif // AUTO_REPORT_SD_STATUS
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read the next block of the print file into a free buffer
+   */
+  bool CardReader::fill_read_ahead() {
+    uint8_t i = ra_index + ra_count;
+    if (i >= SD_READ_AHEAD_BLOCKS) i -= SD_READ_AHEAD_BLOCKS;
+    if (!file.readAhead(ra_fill_pos, ra_cluster, ra_buffer[i])) return false;
+    ra_fill_pos += 512;
+    ra_count++;
+    return true;
+  }
+
+  /**
+   * Get the next byte of the print file from the read-ahead buffers.
+   * Blocks are normally read by read_ahead() during idle time, so only
+   * a buffer underrun makes get() wait on the card.
+   */
+  int16_t CardReader::get() {
+    if (!flag.read_ahead) {
+      // Start reading ahead from the current file position
+      ra_pos = file.curPosition();
+      ra_fill_pos = ra_pos & ~0x1FFUL;
+      file.seekSet(ra_fill_pos);
+      ra_cluster = file.curCluster();
+      ra_index = ra_count = 0;
+      flag.read_ahead = true;
+    }
+
+    sdpos = ra_pos;
+    if (ra_pos >= filesize || (!ra_count && !fill_read_ahead())) return -1;
+
+    const uint8_t c = ra_buffer[ra_index][ra_pos & 0x1FF];
+    if (!(++ra_pos & 0x1FF)) {            // Done with this block?
+      if (++ra_index >= SD_READ_AHEAD_BLOCKS) ra_index = 0;
+      ra_count--;
+    }
+    return c;
+  }
+
+  /**
+   * Fill one free buffer per call while printing. Called from idle().
+   */
+  void CardReader::read_ahead() {
+    if (flag.read_ahead && flag.sdprinting && ra_count < SD_READ_AHEAD_BLOCKS && ra_fill_pos < filesize)
+      fill_read_ahead();
+  }
+
+  /**
+   * Move the file position to the next unread byte so
+   * the file can be read directly again.
+   */
+  void CardReader::end_read_ahead() {
+    if (!flag.read_ahead) return;
+    flag.read_ahead = false;
+    file.seekSet(ra_pos);
+  }
+
+#endif // SD_READ_AHEAD
+
 #if ENABLED(POWER_LOSS_RECOVERY)
 
   bool CardReader::jobRecoverFileExists() {
@@ -1199,7 +1473,8 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    // The journal is synced once per record, not on every write
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | TERN(POWER_LOSS_JOURNAL, 0, O_SYNC)))
       SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
     else if (!read)
       echo_write_to_file(recovery.filename);
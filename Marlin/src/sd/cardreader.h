@@ -43,6 +43,10 @@
 
 #include "SdFile.h"
 
+#if ENABLED(SD_DIR_INDEX)
+  #include "dir_index.h"
+#endif
+
 typedef struct {
   bool saving:1,
        logging:1,
@@ -54,9 +58,23 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_READ_AHEAD)
+         , read_ahead:1
+       #endif
     ;
 } card_flags_t;
 
+#if ENABLED(SD_PAGED_LISTING)
+  // An item in a paged listing (M20 S). Binary pages are made of these.
+  typedef struct __attribute__((__packed__)) {
+    uint16_t index;                       // Item index in folder order
+    uint8_t attributes;                   // DIR_ATT_DIRECTORY for a folder
+    uint32_t size;                        // File size (0 for a folder)
+    char filename[FILENAME_LENGTH];       // DOS 8.3 name
+    char longname[LONG_FILENAME_LENGTH];  // Long name, or empty
+  } sd_listing_record_t;
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -82,6 +100,9 @@ public:
   static void release();
   static inline bool isMounted() { return flag.mounted; }
   static void ls();
+  #if ENABLED(SD_PAGED_LISTING)
+    static int32_t lsPage(const uint16_t start, const uint16_t count, const bool binary=false);
+  #endif
 
   // Handle media insert/remove
   static void manage_media();
@@ -111,6 +132,7 @@ public:
   static void cdroot();
   static void cd(const char *relpath);
   static int8_t cdup();
+  TERN_(SD_PAGED_LISTING, static bool cdIndex(const uint16_t nr));
   static uint16_t countFilesInWorkDir();
   static uint16_t get_num_Files();
 
@@ -159,10 +181,15 @@ public:
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
+  static void setIndex(const uint32_t index);
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t get();
+    static void read_ahead();
+  #else
+    static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
+  #endif
+  static inline int16_t read(void* buf, uint16_t nbyte) { TERN_(SD_READ_AHEAD, end_read_ahead()); return file.isOpen() ? file.read(buf, nbyte) : -1; }
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
   static Sd2Card& getSd2Card() { return sd2card; }
@@ -246,6 +273,19 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  //
+  // Blocks of the print file read ahead of get()
+  //
+  #if ENABLED(SD_READ_AHEAD)
+    static uint8_t ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+    static uint8_t ra_index, ra_count;  // First filled buffer and number of filled buffers
+    static uint32_t ra_pos,             // File position of the next byte to get()
+                    ra_fill_pos,        // File position of the next block to read
+                    ra_cluster;         // Cluster holding the byte before ra_fill_pos
+    static bool fill_read_ahead();
+    static void end_read_ahead();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -272,9 +312,17 @@ private:
   //
   static bool is_dir_or_gcode(const dir_t &p);
   static int countItems(SdFile dir);
-  static void selectByIndex(SdFile dir, const uint8_t index);
+  static void selectByIndex(SdFile dir, const uint16_t index);
   static void selectByName(SdFile dir, const char * const match);
   static void printListing(SdFile parent, const char * const prepend=nullptr);
+  #if ENABLED(SD_PAGED_LISTING)
+    static int32_t listPage(const uint16_t start, const uint16_t count, void (*item)(const sd_listing_record_t &rec));
+  #endif
+
+  #if ENABLED(SD_DIR_INDEX)
+    friend class DirIndex;
+    static void selectRecord(const dir_index_record_t &rec);
+  #endif
 
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
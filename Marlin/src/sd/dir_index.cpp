@@ -0,0 +1,233 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_DIR_INDEX)
+
+#include "dir_index.h"
+#include "cardreader.h"
+
+DirIndex dir_index;
+
+SdFile DirIndex::file;
+bool DirIndex::active; // = false
+uint32_t DirIndex::dir_cluster;
+dir_index_header_t DirIndex::header;
+uint32_t DirIndex::checked[DIR_INDEX_CHECKED];
+uint8_t DirIndex::checked_count; // = 0
+
+static const char index_magic[4] = { 'M', 'D', 'X', '1' };
+static const uint8_t index_dos_name[11] = { 'I', 'N', 'D', 'E', 'X', ' ', ' ', ' ', 'M', 'D', 'X' };
+
+extern char *createFilename(char * const buffer, const uint8_t * const name);
+extern char *createFilename(char * const buffer, const dir_t &p);
+
+void DirIndex::close() {
+  if (!active) return;
+  file.close();
+  active = false;
+}
+
+/**
+ * Forget which folders have been checked. Call this when
+ * the card is mounted or released and when Marlin writes
+ * files, so folders get checked against their index again.
+ */
+void DirIndex::invalidate() {
+  close();
+  checked_count = 0;
+}
+
+bool DirIndex::was_checked(const uint32_t cluster) {
+  LOOP_L_N(i, checked_count) if (checked[i] == cluster) return true;
+  return false;
+}
+
+void DirIndex::set_checked(const uint32_t cluster) {
+  if (was_checked(cluster)) return;
+  if (checked_count == DIR_INDEX_CHECKED) {
+    // Forget the oldest folder
+    LOOP_L_N(i, DIR_INDEX_CHECKED - 1) checked[i] = checked[i + 1];
+    checked_count--;
+  }
+  checked[checked_count++] = cluster;
+}
+
+/**
+ * Hash a DOS filename, ignoring case
+ */
+uint16_t DirIndex::hash(const char *name) {
+  uint16_t h = 5381;
+  while (*name) h = (h << 5) + h + toupper(*name++);
+  return h;
+}
+
+/**
+ * Hash the raw directory entries of a folder. Skip the entry of the index
+ * itself, which changes when the index is written, and the access dates.
+ */
+uint32_t DirIndex::signature(SdFile &dir) {
+  uint32_t h = 2166136261UL; // FNV-1a
+  dir_t p;
+  dir.rewind();
+  while (dir.read(&p, sizeof(p)) == sizeof(p) && p.name[0] != DIR_NAME_FREE) {
+    if (!memcmp(p.name, index_dos_name, sizeof(p.name))) continue;
+    p.lastAccessDate = 0;
+    const uint8_t *b = (uint8_t*)&p;
+    LOOP_L_N(i, sizeof(p)) h = (h ^ b[i]) * 16777619UL;
+  }
+  return h;
+}
+
+/**
+ * Write a new index for a folder, listing the same
+ * items as a scan of the folder with readDir().
+ */
+bool DirIndex::rebuild(SdFile &dir) {
+  if (!file.open(&dir, DIR_INDEX_FILENAME, O_CREAT | O_RDWR | O_TRUNC)) return false;
+  active = true;
+
+  memcpy(header.magic, index_magic, sizeof(header.magic));
+  header.record_size = sizeof(dir_index_record_t);
+  header.count = header.sorted = 0;
+  header.signature = 0;
+  header.sort_mode = 0;
+  header.reserved = 0;
+  bool ok = file.write(&header, sizeof(header)) == sizeof(header);
+
+  dir_t p;
+  dir_index_record_t rec;
+  char dosFilename[FILENAME_LENGTH];
+  dir.rewind();
+  while (ok && dir.readDir(&p, card.longFilename) > 0) {
+    if (!card.is_dir_or_gcode(p)) continue;
+    rec.hash = hash(createFilename(dosFilename, p));
+    rec.entry = dir.curPosition() / sizeof(dir_t) - 1;
+    memcpy(rec.name, p.name, sizeof(rec.name));
+    rec.attributes = p.attributes;
+    rec.size = p.fileSize;
+    rec.date = p.lastWriteDate;
+    rec.time = p.lastWriteTime;
+    memcpy(rec.longname, card.longFilename, sizeof(rec.longname));
+    ok = file.write(&rec, sizeof(rec)) == sizeof(rec);
+    header.count++;
+  }
+
+  // Sign the index once its own directory entry exists
+  if (ok) {
+    header.signature = signature(dir);
+    ok = file.seekSet(0) && file.write(&header, sizeof(header)) == sizeof(header) && file.sync();
+  }
+
+  if (!ok) close();
+  return ok;
+}
+
+/**
+ * Open the index of a folder, checking it against the folder's
+ * directory entries unless the folder was checked already.
+ * An index that is missing or out of date is rebuilt.
+ *
+ *  validate - Set false to only use an index that was already checked
+ *
+ * Return false if the folder has no usable index.
+ */
+bool DirIndex::use(SdFile &dir, const bool validate/*=true*/) {
+  const uint32_t cluster = dir.firstCluster();
+  if (active && cluster == dir_cluster) return true;
+
+  close();
+  const bool trusted = was_checked(cluster);
+  if (!trusted && !validate) return false;
+
+  if (file.open(&dir, DIR_INDEX_FILENAME, O_RDWR)) {
+    active = true;
+    const bool valid = file.read(&header, sizeof(header)) == sizeof(header)
+      && !memcmp(header.magic, index_magic, sizeof(header.magic))
+      && header.record_size == sizeof(dir_index_record_t)
+      && (trusted || header.signature == signature(dir));
+    if (!valid) close();
+  }
+
+  if (!active && !(validate && rebuild(dir))) return false;
+
+  dir_cluster = cluster;
+  set_checked(cluster);
+  return true;
+}
+
+/**
+ * Read the record of an item by its position in the folder
+ */
+bool DirIndex::get(const uint16_t nr, dir_index_record_t &rec) {
+  return active && nr < header.count
+    && file.seekSet(sizeof(header) + uint32_t(nr) * sizeof(rec))
+    && file.read(&rec, sizeof(rec)) == sizeof(rec);
+}
+
+/**
+ * Find an item by DOS name, ignoring case
+ *
+ * Return the item's position in the folder, or -1 if not found.
+ */
+int16_t DirIndex::find(const char * const match, dir_index_record_t &rec) {
+  if (!active || !file.seekSet(sizeof(header))) return -1;
+  const uint16_t h = hash(match);
+  char dosFilename[FILENAME_LENGTH];
+  LOOP_L_N(nr, header.count) {
+    if (file.read(&rec, sizeof(rec)) != sizeof(rec)) break;
+    if (rec.hash == h && strcasecmp(match, createFilename(dosFilename, rec.name)) == 0) return nr;
+  }
+  return -1;
+}
+
+#if ENABLED(SDCARD_SORT_ALPHA)
+
+  /**
+   * Get the sort order saved with the index, if it
+   * was made for the same items and sort settings.
+   */
+  bool DirIndex::load_order(uint8_t * const order, const uint16_t n, const int8_t mode) {
+    return active && header.sorted == n && header.sort_mode == mode
+      && file.seekSet(sizeof(header) + uint32_t(header.count) * sizeof(dir_index_record_t))
+      && file.read(order, n) == int16_t(n);
+  }
+
+  /**
+   * Save a sort order after the records of the index
+   */
+  void DirIndex::save_order(const uint8_t * const order, const uint16_t n, const int8_t mode) {
+    if (!active) return;
+    header.sorted = n;
+    header.sort_mode = mode;
+    if (!file.seekSet(sizeof(header) + uint32_t(header.count) * sizeof(dir_index_record_t))
+      || file.write(order, n) != int16_t(n)
+      || !file.seekSet(0)
+      || file.write(&header, sizeof(header)) != sizeof(header)
+      || !file.sync()
+    ) header.sorted = 0;
+  }
+
+#endif // SDCARD_SORT_ALPHA
+
+#endif // SD_DIR_INDEX
@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * dir_index.h - Persistent index of the items in an SD folder
+ *
+ * Each folder gets an INDEX.MDX file listing its folders and G-code files
+ * with their names, sizes and dates, plus the last sort order. The index is
+ * checked against a hash of the raw directory entries, so it's rebuilt only
+ * when the folder has changed. Folders already checked since the card was
+ * mounted are trusted until Marlin writes to the card.
+ */
+
+#include "SdFile.h"
+
+#define DIR_INDEX_FILENAME "INDEX.MDX"
+
+typedef struct {
+  uint16_t hash;                        // Hash of the DOS name, for quick lookups
+  uint16_t entry;                       // Position of the entry in the folder
+  uint8_t name[11];                     // Raw DOS 8.3 name
+  uint8_t attributes;                   // Directory entry attributes
+  uint32_t size;                        // File size
+  uint16_t date, time;                  // Last write date and time
+  char longname[LONG_FILENAME_LENGTH];  // Long filename, if any
+} dir_index_record_t;
+
+typedef struct {
+  char magic[4];                        // "MDX" and version
+  uint16_t record_size;                 // Must match this build's record
+  uint16_t count;                       // Number of records
+  uint32_t signature;                   // Hash of the folder's directory entries
+  uint16_t sorted;                      // Items in the saved sort order
+  int8_t sort_mode;                     // Sort settings for the saved order
+  uint8_t reserved;
+} dir_index_header_t;
+
+class DirIndex {
+public:
+  static bool use(SdFile &dir, const bool validate=true);
+  static void invalidate();
+  static inline uint16_t count() { return header.count; }
+  static bool get(const uint16_t nr, dir_index_record_t &rec);
+  static int16_t find(const char * const match, dir_index_record_t &rec);
+  static uint16_t hash(const char *name);
+
+  #if ENABLED(SDCARD_SORT_ALPHA)
+    static bool load_order(uint8_t * const order, const uint16_t n, const int8_t mode);
+    static void save_order(const uint8_t * const order, const uint16_t n, const int8_t mode);
+  #endif
+
+private:
+  static SdFile file;
+  static bool active;
+  static uint32_t dir_cluster;          // Folder of the open index
+  static dir_index_header_t header;
+
+  #define DIR_INDEX_CHECKED 8
+  static uint32_t checked[DIR_INDEX_CHECKED];
+  static uint8_t checked_count;
+
+  static void close();
+  static bool was_checked(const uint32_t cluster);
+  static void set_checked(const uint32_t cluster);
+  static uint32_t signature(SdFile &dir);
+  static bool rebuild(SdFile &dir);
+};
+
+extern DirIndex dir_index;